@@ -0,0 +1,92 @@
+"""
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ """
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_HUMIDITY,
+    CONF_ID,
+    CONF_TEMPERATURE,
+    DEVICE_CLASS_HUMIDITY,
+    DEVICE_CLASS_TEMPERATURE,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_PERCENT,
+)
+
+from .. import dew_point_ns
+
+DewPointComponent = dew_point_ns.class_("DewPointComponent", cg.Component)
+
+CONF_TEMPERATURE_SOURCE = "temperature_source"
+CONF_HUMIDITY_SOURCE = "humidity_source"
+CONF_TEMPERATURE_SCALE = "temperature_scale"
+CONF_DEW_POINT_OFFSET = "dew_point_offset"
+CONF_DEW_POINT = "dew_point"
+UNIT_FAHRENHEIT = "°F"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(DewPointComponent),
+        cv.Required(CONF_TEMPERATURE_SOURCE): cv.use_id(sensor.Sensor),
+        cv.Required(CONF_HUMIDITY_SOURCE): cv.use_id(sensor.Sensor),
+        cv.Optional(CONF_TEMPERATURE_SCALE, default=1.0): cv.positive_float,
+        cv.Optional(CONF_DEW_POINT_OFFSET, default=0.0): cv.float_,
+        cv.Optional(CONF_TEMPERATURE): sensor.sensor_schema(
+            unit_of_measurement=UNIT_FAHRENHEIT,
+            accuracy_decimals=1,
+            device_class=DEVICE_CLASS_TEMPERATURE,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_HUMIDITY): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            accuracy_decimals=1,
+            device_class=DEVICE_CLASS_HUMIDITY,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+        cv.Optional(CONF_DEW_POINT): sensor.sensor_schema(
+            unit_of_measurement=UNIT_FAHRENHEIT,
+            accuracy_decimals=1,
+            device_class=DEVICE_CLASS_TEMPERATURE,
+            state_class=STATE_CLASS_MEASUREMENT,
+        ),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    temperature_source = await cg.get_variable(config[CONF_TEMPERATURE_SOURCE])
+    cg.add(var.set_temperature_source(temperature_source))
+    humidity_source = await cg.get_variable(config[CONF_HUMIDITY_SOURCE])
+    cg.add(var.set_humidity_source(humidity_source))
+    cg.add(var.set_temperature_scale(config[CONF_TEMPERATURE_SCALE]))
+    cg.add(var.set_dew_point_offset(config[CONF_DEW_POINT_OFFSET]))
+
+    if temperature_config := config.get(CONF_TEMPERATURE):
+        sens = await sensor.new_sensor(temperature_config)
+        cg.add(var.set_temperature_sensor(sens))
+    if humidity_config := config.get(CONF_HUMIDITY):
+        sens = await sensor.new_sensor(humidity_config)
+        cg.add(var.set_humidity_sensor(sens))
+    if dew_point_config := config.get(CONF_DEW_POINT):
+        sens = await sensor.new_sensor(dew_point_config)
+        cg.add(var.set_dew_point_sensor(sens))
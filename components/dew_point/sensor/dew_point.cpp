@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dew_point.h"
+
+#include <cmath>
+
+#include "../fast_math.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace dew_point {
+
+    constexpr char TAG[] = "dew_point";
+
+    // Magnus coefficients (Sonntag 1990), valid from -45 °C to 60 °C.
+    constexpr float MAGNUS_A = 17.625f;
+    constexpr float MAGNUS_B = 243.04f;
+    // Both values of one sensor read arrive in the same update; anything further apart is not a pair.
+    constexpr uint32_t MAX_PAIR_SKEW_MS = 1000;
+
+    static float celsius_to_fahrenheit(float celsius) { return celsius * 1.8f + 32.0f; }
+    static float fahrenheit_to_celsius(float fahrenheit) { return (fahrenheit - 32.0f) / 1.8f; }
+    static float magnus_gamma(float celsius) { return MAGNUS_A * celsius / (MAGNUS_B + celsius); }
+
+    void DewPointComponent::setup() {
+        // Raw callbacks see the driver's value before any user filters, in driver units.
+        this->temperature_source_->add_on_raw_state_callback([this](float value) { this->on_temperature_(value); });
+        this->humidity_source_->add_on_raw_state_callback([this](float value) { this->on_humidity_(value); });
+    }
+
+    void DewPointComponent::dump_config() {
+        ESP_LOGCONFIG(TAG, "Dew point:");
+        ESP_LOGCONFIG(TAG, "  Temperature scale: %.4f", this->temperature_scale_);
+        ESP_LOGCONFIG(TAG, "  Dew point offset: %.2f °F", this->dew_point_offset_);
+    }
+
+    void DewPointComponent::on_temperature_(float celsius) {
+        if (std::isnan(celsius)) {
+            return;
+        }
+
+        this->temperature_f_ = celsius_to_fahrenheit(celsius) * this->temperature_scale_;
+        this->temperature_time_ = millis();
+        this->has_temperature_ = true;
+        if (this->temperature_sensor_ != nullptr) {
+            this->temperature_sensor_->publish_state(this->temperature_f_);
+        }
+        this->publish_pair_();
+    }
+
+    void DewPointComponent::on_humidity_(float relative_humidity) {
+        if (std::isnan(relative_humidity)) {
+            return;
+        }
+
+        this->relative_humidity_ = relative_humidity;
+        this->humidity_time_ = millis();
+        this->has_humidity_ = true;
+        this->publish_pair_();
+    }
+
+    void DewPointComponent::publish_pair_() {
+        if (!this->has_temperature_ || !this->has_humidity_) {
+            return;
+        }
+
+        // Keep the newer sample waiting for its partner if the two are from different reads.
+        const uint32_t skew = this->temperature_time_ - this->humidity_time_;
+        if (static_cast<int32_t>(skew) > static_cast<int32_t>(MAX_PAIR_SKEW_MS)) {
+            this->has_humidity_ = false;
+            return;
+        }
+        if (static_cast<int32_t>(skew) < -static_cast<int32_t>(MAX_PAIR_SKEW_MS)) {
+            this->has_temperature_ = false;
+            return;
+        }
+        this->has_temperature_ = false;
+        this->has_humidity_ = false;
+
+        if (this->relative_humidity_ <= 0.0f) {
+            ESP_LOGW(TAG, "Relative humidity %.1f%% has no dew point", this->relative_humidity_);
+            return;
+        }
+
+        const float temperature_c = fahrenheit_to_celsius(this->temperature_f_);
+        const float gamma_t = magnus_gamma(temperature_c);
+        const float gamma = fast_logf(this->relative_humidity_ / 100.0f) + gamma_t;
+        const float dew_point_c = MAGNUS_B * gamma / (MAGNUS_A - gamma);
+
+        const float corrected_dew_point_f = celsius_to_fahrenheit(dew_point_c) + this->dew_point_offset_;
+        const float gamma_d = magnus_gamma(fahrenheit_to_celsius(corrected_dew_point_f));
+        float corrected_humidity = 100.0f * fast_expf(gamma_d - gamma_t);
+        if (corrected_humidity > 100.0f) {
+            corrected_humidity = 100.0f;
+        }
+
+        if (this->dew_point_sensor_ != nullptr) {
+            this->dew_point_sensor_->publish_state(corrected_dew_point_f);
+        }
+        if (this->humidity_sensor_ != nullptr) {
+            this->humidity_sensor_->publish_state(corrected_humidity);
+        }
+    }
+
+} // namespace dew_point
+} // namespace esphome
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace dew_point {
+
+// Pairs the raw temperature (°C) and relative humidity samples from one sensor read, then publishes
+// the scaled temperature (°F), the offset-corrected dew point (°F) and the humidity recomputed from it.
+class DewPointComponent : public Component {
+public:
+    void setup() override;
+    void dump_config() override;
+    float get_setup_priority() const override { return setup_priority::DATA; }
+
+    void set_temperature_source(sensor::Sensor *source) { this->temperature_source_ = source; }
+    void set_humidity_source(sensor::Sensor *source) { this->humidity_source_ = source; }
+    void set_temperature_scale(float scale) { this->temperature_scale_ = scale; }
+    void set_dew_point_offset(float offset) { this->dew_point_offset_ = offset; }
+
+    void set_temperature_sensor(sensor::Sensor *sensor) { this->temperature_sensor_ = sensor; }
+    void set_humidity_sensor(sensor::Sensor *sensor) { this->humidity_sensor_ = sensor; }
+    void set_dew_point_sensor(sensor::Sensor *sensor) { this->dew_point_sensor_ = sensor; }
+
+protected:
+    void on_temperature_(float celsius);
+    void on_humidity_(float relative_humidity);
+    void publish_pair_();
+
+    sensor::Sensor *temperature_source_{nullptr};
+    sensor::Sensor *humidity_source_{nullptr};
+    sensor::Sensor *temperature_sensor_{nullptr};
+    sensor::Sensor *humidity_sensor_{nullptr};
+    sensor::Sensor *dew_point_sensor_{nullptr};
+    float           temperature_scale_{1.0f};
+    float           dew_point_offset_{0.0f};
+    float           temperature_f_{0.0f};
+    float           relative_humidity_{0.0f};
+    uint32_t        temperature_time_{0};
+    uint32_t        humidity_time_{0};
+    bool            has_temperature_{false};
+    bool            has_humidity_{false};
+};
+
+} // namespace dew_point
+} // namespace esphome
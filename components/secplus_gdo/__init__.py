@@ -19,18 +19,73 @@
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import pins
+from esphome import automation, pins
+from esphome.components import socket
 from esphome.const import CONF_ID, CONF_NUMBER, __version__ as ESPHOME_VERSION
 from esphome.core import CORE
 
 DEPENDENCIES = ["esp32", "preferences"]
+AUTO_LOAD = ["socket"]
 
 secplus_gdo_ns = cg.esphome_ns.namespace("secplus_gdo")
 SECPLUS_GDO = secplus_gdo_ns.class_("GDOComponent", cg.Component)
+SetLogLevelAction = secplus_gdo_ns.class_("SetLogLevelAction", automation.Action)
+ResyncAction = secplus_gdo_ns.class_("ResyncAction", automation.Action)
+ResetDoorTimingsAction = secplus_gdo_ns.class_("ResetDoorTimingsAction", automation.Action)
+DumpHistoryAction = secplus_gdo_ns.class_("DumpHistoryAction", automation.Action)
 
 CONF_OUTPUT_GDO = "output_gdo_pin"
 CONF_INPUT_GDO = "input_gdo_pin"
+CONF_OBSTRUCTION_PIN = "obstruction_pin"
 CONF_SECPLUS_GDO_ID = "secplus_gdo_id"
+CONF_TRIGGER_ATTRIBUTION_WINDOW = "trigger_attribution_window"
+CONF_LOOP_PROFILE = "loop_profile"
+CONF_REPORT_INTERVAL = "report_interval"
+CONF_BUDGET = "budget"
+CONF_LOG_MODE = "log_mode"
+CONF_LOG_BUFFER_SIZE = "log_buffer_size"
+CONF_PRIORITY_EVENTS = "priority_events"
+CONF_UART_RX_FULL_THRESHOLD = "uart_rx_full_threshold"
+CONF_UART_RX_TIMEOUT = "uart_rx_timeout"
+CONF_TASK_PRIORITY = "task_priority"
+CONF_ROLLING_CODE_SNIFF = "rolling_code_sniff"
+CONF_MONITOR_ONLY = "monitor_only"
+CONF_SUBSYSTEM = "subsystem"
+CONF_LEVEL = "level"
+CONF_HISTORY = "history"
+CONF_PARTITION = "partition"
+CONF_FLUSH_INTERVAL = "flush_interval"
+CONF_SINCE = "since"
+CONF_UNTIL = "until"
+CONF_TYPES = "types"
+
+# Bit positions match HistoryKind in event_history.h.
+HISTORY_TYPES = {
+    "door": 1,
+    "light": 2,
+    "lock": 3,
+    "obstruction": 4,
+    "motion": 5,
+}
+
+LOG_SUBSYSTEMS = {
+    "component": 0,
+    "door": 1,
+    "light": 2,
+    "lock": 3,
+}
+
+# Matches the ESPHOME_LOG_LEVEL_* values from esphome/core/log.h.
+LOG_LEVELS = {
+    "NONE": 0,
+    "ERROR": 1,
+    "WARN": 2,
+    "INFO": 3,
+    "CONFIG": 4,
+    "DEBUG": 5,
+    "VERBOSE": 6,
+    "VERY_VERBOSE": 7,
+}
 
 GDO_RESERVED_IDS = frozenset(
     {
@@ -71,6 +126,7 @@ GDO_RESERVED_IDS = frozenset(
         "gdo_motor_state_to_string",
         "gdo_button_state_to_string",
         "gdo_battery_state_to_string",
+        "decode_wireline",
     }
 )
 
@@ -90,9 +146,49 @@ def validate_cpp_symbol_id(config, key=CONF_ID):
     return config
 
 
+def add_feature_define(platform, entity_type=None):
+    """Record a configured platform (and entity type) so the hub compiles in only the handlers it needs."""
+    cg.add_define(f"USE_SECPLUS_GDO_{platform.upper()}")
+    if entity_type is not None:
+        cg.add_define(f"USE_SECPLUS_GDO_{platform.upper()}_{entity_type.upper()}")
+
+
+def is_monitor_only(hub_id):
+    """Whether the hub a platform points at only listens; control-only entities are then left out of the build."""
+    return CORE.data.get("secplus_gdo", {}).get(hub_id.id, False)
+
+
+def validate_monitor_only(config):
+    if config[CONF_MONITOR_ONLY] and CONF_ROLLING_CODE_SNIFF in config:
+        raise cv.Invalid("rolling_code_sniff has no effect with monitor_only, which never syncs")
+    # Recorded during validation so platform code generation can consult it regardless of order.
+    CORE.data.setdefault("secplus_gdo", {})[config[CONF_ID].id] = config[CONF_MONITOR_ONLY]
+    return config
+
+
+def record_dump_history_use(config):
+    # Actions can be validated before the hub, so the check against its history runs in final validation.
+    CORE.data["secplus_gdo_dump_history"] = True
+    return config
+
+
+def final_validate_history(config):
+    if CORE.data.get("secplus_gdo_dump_history", False) and CONF_HISTORY not in config:
+        raise cv.Invalid("secplus_gdo.dump_history needs history configured on the secplus_gdo component")
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = final_validate_history
+
+
 def validate_gdo_pins(config):
     if config[CONF_OUTPUT_GDO][CONF_NUMBER] == config[CONF_INPUT_GDO][CONF_NUMBER]:
         raise cv.Invalid("input_gdo_pin and output_gdo_pin must use different pins")
+    if CONF_OBSTRUCTION_PIN in config and config[CONF_OBSTRUCTION_PIN][CONF_NUMBER] in (
+        config[CONF_OUTPUT_GDO][CONF_NUMBER],
+        config[CONF_INPUT_GDO][CONF_NUMBER],
+    ):
+        raise cv.Invalid("obstruction_pin must not share a pin with the GDO UART")
     return config
 
 
@@ -102,11 +198,40 @@ CONFIG_SCHEMA = cv.All(
             cv.GenerateID(): cv.declare_id(SECPLUS_GDO),
             cv.Required(CONF_OUTPUT_GDO): pins.gpio_output_pin_schema,
             cv.Required(CONF_INPUT_GDO): pins.gpio_input_pin_schema,
+            cv.Optional(CONF_OBSTRUCTION_PIN): pins.internal_gpio_input_pin_schema,
+            cv.Optional(CONF_TRIGGER_ATTRIBUTION_WINDOW, default="3s"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_LOG_MODE, default="direct"): cv.one_of("direct", "deferred", lower=True),
+            cv.Optional(CONF_LOG_BUFFER_SIZE, default=64): cv.int_range(min=8, max=1024),
+            cv.Optional(CONF_PRIORITY_EVENTS, default=False): cv.boolean,
+            cv.Optional(CONF_MONITOR_ONLY, default=False): cv.boolean,
+            cv.Optional(CONF_UART_RX_FULL_THRESHOLD): cv.int_range(min=1, max=127),
+            cv.Optional(CONF_UART_RX_TIMEOUT): cv.int_range(min=1, max=126),
+            cv.Optional(CONF_TASK_PRIORITY): cv.int_range(min=1, max=22),
+            cv.Optional(CONF_ROLLING_CODE_SNIFF): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(max=cv.TimePeriod(seconds=60)),
+            ),
+            cv.Optional(CONF_HISTORY): cv.Schema(
+                {
+                    cv.Optional(CONF_PARTITION, default="gdo_history"): cv.string_strict,
+                    cv.Optional(CONF_FLUSH_INTERVAL, default="60s"): cv.All(
+                        cv.positive_time_period_milliseconds,
+                        cv.Range(min=cv.TimePeriod(seconds=1)),
+                    ),
+                }
+            ),
+            cv.Optional(CONF_LOOP_PROFILE): cv.Schema(
+                {
+                    cv.Optional(CONF_REPORT_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_BUDGET, default="10ms"): cv.positive_time_period_microseconds,
+                }
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.only_on_esp32,
     cv.only_with_framework("esp-idf"),
     validate_gdo_pins,
+    validate_monitor_only,
     validate_cpp_symbol_id,
 )
 
@@ -120,6 +245,8 @@ SECPLUS_GDO_CONFIG_SCHEMA = cv.Schema(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    cg.add_define("USE_SECPLUS_GDO")
+    cg.add(var.set_trigger_attribution_window(config[CONF_TRIGGER_ATTRIBUTION_WINDOW]))
 
     if (
         CORE.is_esp32
@@ -134,3 +261,122 @@ async def to_code(config):
 
     cg.add_define("GDO_UART_TX_PIN", config[CONF_OUTPUT_GDO][CONF_NUMBER])
     cg.add_define("GDO_UART_RX_PIN", config[CONF_INPUT_GDO][CONF_NUMBER])
+
+    # gdolib events wake the main loop from its idle sleep instead of waiting for the next iteration.
+    if require_wake_loop := getattr(socket, "require_wake_loop_threadsafe", None):
+        require_wake_loop()
+
+    if config[CONF_PRIORITY_EVENTS]:
+        cg.add_define("USE_SECPLUS_GDO_PRIORITY_EVENTS")
+
+    if config[CONF_MONITOR_ONLY]:
+        cg.add_define("USE_SECPLUS_GDO_MONITOR_ONLY")
+
+    if CONF_UART_RX_FULL_THRESHOLD in config:
+        cg.add(var.set_uart_rx_full_threshold(config[CONF_UART_RX_FULL_THRESHOLD]))
+    if CONF_UART_RX_TIMEOUT in config:
+        cg.add(var.set_uart_rx_timeout(config[CONF_UART_RX_TIMEOUT]))
+    if CONF_TASK_PRIORITY in config:
+        cg.add(var.set_task_priority(config[CONF_TASK_PRIORITY]))
+
+    if CONF_ROLLING_CODE_SNIFF in config:
+        cg.add_define("USE_SECPLUS_GDO_ROLLING_CODE_SNIFF")
+        cg.add(var.set_rolling_code_sniff_duration(config[CONF_ROLLING_CODE_SNIFF]))
+
+    if obstruction_pin := config.get(CONF_OBSTRUCTION_PIN):
+        cg.add_define("USE_SECPLUS_GDO_OBSTRUCTION_PIN")
+        pin = await cg.gpio_pin_expression(obstruction_pin)
+        cg.add(var.set_obstruction_pin(pin))
+
+    if loop_profile := config.get(CONF_LOOP_PROFILE):
+        cg.add_define("USE_SECPLUS_GDO_LOOP_PROFILE")
+        cg.add(var.set_loop_profile_report_interval(loop_profile[CONF_REPORT_INTERVAL]))
+        cg.add(var.set_loop_profile_budget(loop_profile[CONF_BUDGET]))
+
+    if history := config.get(CONF_HISTORY):
+        cg.add_define("USE_SECPLUS_GDO_HISTORY")
+        cg.add(var.set_history(history[CONF_PARTITION], history[CONF_FLUSH_INTERVAL]))
+
+    if config[CONF_LOG_MODE] == "deferred":
+        cg.add_define("USE_SECPLUS_GDO_DEFERRED_LOG")
+        cg.add_define("SECPLUS_GDO_LOG_BUFFER_SIZE", config[CONF_LOG_BUFFER_SIZE])
+
+
+@automation.register_action(
+    "secplus_gdo.set_log_level",
+    SetLogLevelAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SECPLUS_GDO),
+            cv.Required(CONF_SUBSYSTEM): cv.enum(LOG_SUBSYSTEMS, lower=True),
+            cv.Required(CONF_LEVEL): cv.enum(LOG_LEVELS, upper=True),
+        }
+    ),
+)
+async def secplus_gdo_set_log_level_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    cg.add(var.set_subsystem(LOG_SUBSYSTEMS[config[CONF_SUBSYSTEM]]))
+    cg.add(var.set_level(LOG_LEVELS[config[CONF_LEVEL]]))
+    return var
+
+
+@automation.register_action(
+    "secplus_gdo.resync",
+    ResyncAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SECPLUS_GDO),
+        }
+    ),
+)
+async def secplus_gdo_resync_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "secplus_gdo.reset_door_timings",
+    ResetDoorTimingsAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SECPLUS_GDO),
+        }
+    ),
+)
+async def secplus_gdo_reset_door_timings_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "secplus_gdo.dump_history",
+    DumpHistoryAction,
+    cv.All(
+        cv.Schema(
+            {
+                cv.GenerateID(): cv.use_id(SECPLUS_GDO),
+                cv.Optional(CONF_SINCE, default=0): cv.templatable(cv.uint32_t),
+                cv.Optional(CONF_UNTIL, default=0xFFFFFFFF): cv.templatable(cv.uint32_t),
+                cv.Optional(CONF_TYPES, default=list(HISTORY_TYPES)): cv.ensure_list(
+                    cv.enum(HISTORY_TYPES, lower=True)
+                ),
+            }
+        ),
+        record_dump_history_use,
+    ),
+)
+async def secplus_gdo_dump_history_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    since = await cg.templatable(config[CONF_SINCE], args, cg.uint32)
+    cg.add(var.set_since(since))
+    until = await cg.templatable(config[CONF_UNTIL], args, cg.uint32)
+    cg.add(var.set_until(until))
+    kinds = 0
+    for kind in config[CONF_TYPES]:
+        kinds |= 1 << HISTORY_TYPES[kind]
+    cg.add(var.set_kinds(kinds))
+    return var
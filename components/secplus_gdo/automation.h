@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO
+
+#include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+#include "secplus_gdo.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+    template<typename... Ts> class SetLogLevelAction : public Action<Ts...>, public Parented<GDOComponent> {
+    public:
+        void set_subsystem(uint8_t subsystem) { this->subsystem_ = static_cast<LogSubsystem>(subsystem); }
+        void set_level(uint8_t level) { this->level_ = level; }
+
+        void play(const Ts &...x) override { this->parent_->set_log_level(this->subsystem_, this->level_); }
+
+    protected:
+        LogSubsystem subsystem_{LogSubsystem::COMPONENT};
+        uint8_t      level_{ESPHOME_LOG_LEVEL_DEBUG};
+    };
+
+    template<typename... Ts> class ResyncAction : public Action<Ts...>, public Parented<GDOComponent> {
+    public:
+        void play(const Ts &...x) override { this->parent_->resync(); }
+    };
+
+    template<typename... Ts> class ResetDoorTimingsAction : public Action<Ts...>, public Parented<GDOComponent> {
+    public:
+        void play(const Ts &...x) override { this->parent_->reset_door_timings(); }
+    };
+
+#ifdef USE_SECPLUS_GDO_HISTORY
+    template<typename... Ts> class DumpHistoryAction : public Action<Ts...>, public Parented<GDOComponent> {
+    public:
+        TEMPLATABLE_VALUE(uint32_t, since)
+        TEMPLATABLE_VALUE(uint32_t, until)
+        void set_kinds(uint8_t kinds) { this->kinds_ = kinds; }
+
+        void play(const Ts &...x) override {
+            HistoryQuery query;
+            query.since_s = this->since_.value(x...);
+            query.until_s = this->until_.value(x...);
+            query.kinds = this->kinds_;
+            this->parent_->dump_history(query);
+        }
+
+    protected:
+        uint8_t kinds_{0xff};
+    };
+#endif
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO
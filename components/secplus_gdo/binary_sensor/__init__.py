@@ -22,7 +22,13 @@ import esphome.config_validation as cv
 from esphome.components import binary_sensor
 from esphome.const import CONF_ID
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -38,6 +44,7 @@ TYPES = {
     "button": 3,
     "sync": 4,
     "wireless_remote": 5,
+    "travel_drift": 6,
 }
 
 CONFIG_SCHEMA = cv.All(
@@ -57,5 +64,6 @@ async def to_code(config):
     await binary_sensor.register_binary_sensor(var, config)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("binary_sensor", config[CONF_TYPE])
     cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
     cg.add(parent.register_binary_sensor(var))
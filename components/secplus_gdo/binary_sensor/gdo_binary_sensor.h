@@ -34,6 +34,7 @@ enum class GDOBinarySensorType : uint8_t {
     BUTTON,
     SYNC,
     WIRELESS_REMOTE,
+    TRAVEL_DRIFT,
 };
 
 class GDOBinarySensor : public binary_sensor::BinarySensor, public Component {
@@ -58,6 +59,8 @@ protected:
             return "sync";
         case GDOBinarySensorType::WIRELESS_REMOTE:
             return "wireless_remote";
+        case GDOBinarySensorType::TRAVEL_DRIFT:
+            return "travel_drift";
         default:
             return "unknown";
         }
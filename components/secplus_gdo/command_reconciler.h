@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Tracks the on/off state last requested for an opener output against the state the opener reports, so
+// rapid changes collapse into one command and a command the opener never confirms is retried.
+// The owning entity drives the timing; this class only keeps the bookkeeping.
+class CommandReconciler {
+public:
+    // Requests closer together than this are merged and only the last one is sent.
+    static constexpr uint32_t COALESCE_MS = 100;
+    // Wait for a confirmation after the first send; doubled after each retry.
+    static constexpr uint32_t RETRY_MS = 1500;
+    static constexpr uint8_t  MAX_ATTEMPTS = 3;
+
+    void request(bool on) {
+        this->desired_ = on;
+        this->pending_ = true;
+        this->attempts_ = 0;
+    }
+
+    // Drops the pending request, e.g. when the opener is no longer synced.
+    void cancel() { this->pending_ = false; }
+
+    bool pending() const { return this->pending_; }
+    bool desired() const { return this->desired_; }
+    bool has_confirmed() const { return this->known_; }
+    bool confirmed() const { return this->confirmed_; }
+    uint8_t attempts() const { return this->attempts_; }
+
+    // True when the opener already reports the requested state, so nothing needs to be sent.
+    bool satisfied() const { return this->known_ && this->confirmed_ == this->desired_; }
+
+    // Starts the next send. Returns false, and drops the request, once all attempts are used up.
+    bool begin_attempt(uint32_t now_ms) {
+        if (this->attempts_ >= MAX_ATTEMPTS) {
+            this->pending_ = false;
+            return false;
+        }
+        if (this->attempts_ == 0) {
+            this->first_sent_ms_ = now_ms;
+        }
+        this->attempts_++;
+        return true;
+    }
+
+    uint32_t retry_delay_ms() const { return RETRY_MS << (this->attempts_ > 0 ? this->attempts_ - 1 : 0); }
+
+    // Records a state reported by the opener. Returns true when it confirms a command that was sent,
+    // with latency_ms set to the time since the first attempt.
+    bool confirm(bool on, uint32_t now_ms, uint32_t *latency_ms) {
+        this->known_ = true;
+        this->confirmed_ = on;
+        if (!this->pending_ || this->attempts_ == 0 || on != this->desired_) {
+            return false;
+        }
+        this->pending_ = false;
+        *latency_ms = now_ms - this->first_sent_ms_;
+        return true;
+    }
+
+protected:
+    uint32_t first_sent_ms_{0};
+    uint8_t  attempts_{0};
+    bool     desired_{false};
+    bool     pending_{false};
+    bool     known_{false};
+    bool     confirmed_{false};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
@@ -19,15 +19,38 @@
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import automation
-from esphome.components import cover
-from esphome.const import CONF_TRIGGER_ID
+import esphome.final_validate as fv
+from esphome import automation, pins
+from esphome.components import binary_sensor, button, cover
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32
+from esphome.const import (
+    CONF_CHANNEL,
+    CONF_DEBOUNCE,
+    CONF_DIRECTION,
+    CONF_ID,
+    CONF_OUTPUT,
+    CONF_PLATFORM,
+    CONF_POSITION,
+    CONF_TIME,
+    CONF_TRIGGER_ID,
+)
+
+from .rtttl import parse_rtttl
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
-DEPENDENCIES = ["secplus_gdo"]
+# The secplus type needs the secplus_gdo hub; the dry_contact type drives a relay and reads a reed switch on its own.
+AUTO_LOAD = ["binary_sensor"]
 
 GDODoor = secplus_gdo_ns.class_("GDODoor", cover.Cover, cg.Component)
+GDODryContactDoor = secplus_gdo_ns.class_("GDODryContactDoor", cover.Cover, cg.Component)
 
 CoverClosingStartTrigger = secplus_gdo_ns.class_(
     "CoverClosingStartTrigger", automation.Trigger.template()
@@ -37,31 +60,264 @@ CoverClosingEndTrigger = secplus_gdo_ns.class_(
     "CoverClosingEndTrigger", automation.Trigger.template()
 )
 
+PositionCrossedTrigger = secplus_gdo_ns.class_(
+    "PositionCrossedTrigger", automation.Trigger.template(cg.float_)
+)
+OpenForTrigger = secplus_gdo_ns.class_("OpenForTrigger", automation.Trigger.template())
+TravelCompleteTrigger = secplus_gdo_ns.class_(
+    "TravelCompleteTrigger", automation.Trigger.template(cg.bool_, cg.uint32)
+)
+ObstructedDuringCloseTrigger = secplus_gdo_ns.class_(
+    "ObstructedDuringCloseTrigger", automation.Trigger.template()
+)
+
+CrossingDirection = secplus_gdo_ns.enum("CrossingDirection", is_class=True)
+CROSSING_DIRECTIONS = {
+    "any": CrossingDirection.ANY,
+    "opening": CrossingDirection.OPENING,
+    "closing": CrossingDirection.CLOSING,
+}
+
+WarningLedPattern = secplus_gdo_ns.enum("WarningLedPattern", is_class=True)
+WARNING_LED_PATTERNS = {
+    "strobe": WarningLedPattern.STROBE,
+    "blink": WarningLedPattern.BLINK,
+    "pulse": WarningLedPattern.PULSE,
+}
+
+CalibrateTravelAction = secplus_gdo_ns.class_("CalibrateTravelAction", automation.Action)
+AutoCloseHoldAction = secplus_gdo_ns.class_("AutoCloseHoldAction", automation.Action)
+
 CONF_PRE_CLOSE_WARNING_DURATION = "pre_close_warning_duration"
 CONF_PRE_CLOSE_WARNING_START = "pre_close_warning_start"
 CONF_PRE_CLOSE_WARNING_END = "pre_close_warning_end"
+CONF_TYPE = "type"
+CONF_OPENER_BUTTON = "opener_button"
+CONF_CLOSED_SENSOR_PIN = "closed_sensor_pin"
+CONF_OPEN_SENSOR_PIN = "open_sensor_pin"
+CONF_OPEN_DURATION = "open_duration"
+CONF_CLOSE_DURATION = "close_duration"
+CONF_CONTACT_SENSOR = "contact_sensor"
+CONF_ON_POSITION_CROSSED = "on_position_crossed"
+CONF_ON_OPEN_FOR = "on_open_for"
+CONF_ON_TRAVEL_COMPLETE = "on_travel_complete"
+CONF_ON_OBSTRUCTED_DURING_CLOSE = "on_obstructed_during_close"
+CONF_AUTO_CLOSE_DELAY = "auto_close_delay"
+CONF_AUTO_CLOSE_HOLD_ON_MOTION = "auto_close_hold_on_motion"
+CONF_AUTO_CLOSE_HOLD_ON_OBSTRUCTION = "auto_close_hold_on_obstruction"
+CONF_HOLD = "hold"
+CONF_WARNING_SEQUENCER = "warning_sequencer"
+CONF_LED_PIN = "led_pin"
+CONF_LED_PATTERN = "led_pattern"
+CONF_BUZZER_PIN = "buzzer_pin"
+CONF_TONE = "tone"
+CONF_TONE_DATA_ID = "tone_data_id"
+
+PRE_CLOSE_WARNING_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PRE_CLOSE_WARNING_DURATION, default=0): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_PRE_CLOSE_WARNING_START): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CoverClosingStartTrigger)}
+        ),
+        cv.Optional(CONF_PRE_CLOSE_WARNING_END): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CoverClosingEndTrigger)}
+        ),
+    }
+)
+
+# Evaluated in GDODoor::set_state from the opener's reports; the dry-contact cover has no position reports.
+SECPLUS_TRIGGERS_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_ON_POSITION_CROSSED): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(PositionCrossedTrigger),
+                cv.Required(CONF_POSITION): cv.percentage,
+                cv.Optional(CONF_DIRECTION, default="any"): cv.enum(CROSSING_DIRECTIONS, lower=True),
+            }
+        ),
+        cv.Optional(CONF_ON_OPEN_FOR): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(OpenForTrigger),
+                cv.Required(CONF_TIME): cv.positive_time_period_milliseconds,
+            }
+        ),
+        cv.Optional(CONF_ON_TRAVEL_COMPLETE): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(TravelCompleteTrigger)}
+        ),
+        cv.Optional(CONF_ON_OBSTRUCTED_DURING_CLOSE): automation.validate_automation(
+            {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(ObstructedDuringCloseTrigger)}
+        ),
+    }
+)
+
+AUTO_CLOSE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_AUTO_CLOSE_DELAY): cv.All(
+            cv.positive_time_period_milliseconds,
+            cv.Range(min=cv.TimePeriod(seconds=10)),
+        ),
+        cv.Optional(CONF_AUTO_CLOSE_HOLD_ON_MOTION, default=True): cv.boolean,
+        cv.Optional(CONF_AUTO_CLOSE_HOLD_ON_OBSTRUCTION, default=True): cv.boolean,
+    }
+)
+
+
+def validate_rtttl(value):
+    value = cv.string_strict(value)
+    try:
+        parse_rtttl(value)
+    except ValueError as err:
+        raise cv.Invalid(str(err)) from err
+    return value
+
+
+# Plays the pre-close warning on LEDC outputs from GDODoor itself, in place of warning_start/end automations.
+WARNING_SEQUENCER_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_WARNING_SEQUENCER): cv.All(
+            cv.Schema(
+                {
+                    cv.Optional(CONF_LED_PIN): pins.internal_gpio_output_pin_schema,
+                    cv.Optional(CONF_LED_PATTERN, default="strobe"): cv.enum(WARNING_LED_PATTERNS, lower=True),
+                    cv.Inclusive(CONF_BUZZER_PIN, "buzzer"): pins.internal_gpio_output_pin_schema,
+                    cv.Inclusive(CONF_TONE, "buzzer"): validate_rtttl,
+                    cv.GenerateID(CONF_TONE_DATA_ID): cv.declare_id(cg.uint16),
+                }
+            ),
+            cv.has_at_least_one_key(CONF_LED_PIN, CONF_BUZZER_PIN),
+        ),
+    }
+)
+
+# ESP32 variants with six LEDC channels; the rest have eight.
+LEDC_SIX_CHANNEL_VARIANTS = ("ESP32C2", "ESP32C3", "ESP32C5", "ESP32C6", "ESP32H2")
+
+
+def warning_sequencer_ledc_channels():
+    """The ledc output channel numbers that map to the two LEDC channels the warning sequencer takes.
+
+    On the original ESP32, ledc outputs number the high-speed channels 0-7 and the low-speed ones 8-15.
+    """
+    variant = get_esp32_variant()
+    if variant == VARIANT_ESP32:
+        return (14, 15)
+    if variant in LEDC_SIX_CHANNEL_VARIANTS:
+        return (4, 5)
+    return (6, 7)
+
+
+def final_validate_warning_sequencer(config):
+    if CONF_WARNING_SEQUENCER not in config:
+        return config
+    reserved = warning_sequencer_ledc_channels()
+    outputs = [output for output in fv.full_config.get().get(CONF_OUTPUT, []) if output.get(CONF_PLATFORM) == "ledc"]
+    for index, output in enumerate(outputs):
+        # Without a channel, an output takes its position among the ledc outputs.
+        channel = output.get(CONF_CHANNEL, index)
+        if channel in reserved:
+            raise cv.Invalid(
+                f"warning_sequencer uses LEDC channels {reserved[0]} and {reserved[1]}; "
+                f"ledc output '{output[CONF_ID]}' is on channel {channel}"
+            )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = final_validate_warning_sequencer
 
 CONFIG_SCHEMA = cv.All(
-    cover.cover_schema(GDODoor)
-    .extend(
+    cv.typed_schema(
         {
-            cv.Optional(CONF_PRE_CLOSE_WARNING_DURATION, default=0): cv.positive_time_period_milliseconds,
-            cv.Optional(CONF_PRE_CLOSE_WARNING_START): automation.validate_automation(
-                {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CoverClosingStartTrigger)}
-            ),
-            cv.Optional(CONF_PRE_CLOSE_WARNING_END): automation.validate_automation(
-                {cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CoverClosingEndTrigger)}
+            "secplus": cover.cover_schema(GDODoor)
+            .extend(PRE_CLOSE_WARNING_SCHEMA)
+            .extend(SECPLUS_TRIGGERS_SCHEMA)
+            .extend(AUTO_CLOSE_SCHEMA)
+            .extend(WARNING_SEQUENCER_SCHEMA)
+            .extend(SECPLUS_GDO_CONFIG_SCHEMA),
+            "dry_contact": cover.cover_schema(GDODryContactDoor)
+            .extend(PRE_CLOSE_WARNING_SCHEMA)
+            .extend(
+                {
+                    cv.Required(CONF_OPENER_BUTTON): cv.use_id(button.Button),
+                    cv.Required(CONF_CLOSED_SENSOR_PIN): pins.internal_gpio_input_pin_schema,
+                    cv.Optional(CONF_OPEN_SENSOR_PIN): pins.internal_gpio_input_pin_schema,
+                    cv.Optional(CONF_DEBOUNCE, default="50ms"): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_OPEN_DURATION, default="15s"): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_CLOSE_DURATION, default="15s"): cv.positive_time_period_milliseconds,
+                    cv.Optional(CONF_CONTACT_SENSOR): binary_sensor.binary_sensor_schema(
+                        device_class="garage_door"
+                    ),
+                }
             ),
-        }
-    ).extend(SECPLUS_GDO_CONFIG_SCHEMA),
+        },
+        key=CONF_TYPE,
+        default_type="secplus",
+        lower=True,
+    ),
     validate_cpp_symbol_id,
 )
 
+
 async def to_code(config):
     var = await cover.new_cover(config)
     await cg.register_component(var, config)
-    parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
-    cg.add(parent.register_door(var))
+    if config[CONF_TYPE] == "dry_contact":
+        cg.add_define("USE_SECPLUS_GDO_DRY_CONTACT")
+        button_ = await cg.get_variable(config[CONF_OPENER_BUTTON])
+        cg.add(var.set_opener_button(button_))
+        pin = await cg.gpio_pin_expression(config[CONF_CLOSED_SENSOR_PIN])
+        cg.add(var.set_closed_sensor_pin(pin))
+        if CONF_OPEN_SENSOR_PIN in config:
+            pin = await cg.gpio_pin_expression(config[CONF_OPEN_SENSOR_PIN])
+            cg.add(var.set_open_sensor_pin(pin))
+        cg.add(var.set_debounce(config[CONF_DEBOUNCE]))
+        cg.add(var.set_open_duration(config[CONF_OPEN_DURATION]))
+        cg.add(var.set_close_duration(config[CONF_CLOSE_DURATION]))
+        if contact_config := config.get(CONF_CONTACT_SENSOR):
+            contact = await binary_sensor.new_binary_sensor(contact_config)
+            cg.add(var.set_contact_sensor(contact))
+    else:
+        parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+        add_feature_define("cover")
+        cg.add(parent.register_door(var))
+        if CONF_AUTO_CLOSE_DELAY in config:
+            cg.add_define("USE_SECPLUS_GDO_AUTO_CLOSE")
+            cg.add(var.set_auto_close_delay(config[CONF_AUTO_CLOSE_DELAY]))
+            cg.add(var.set_auto_close_hold_on_motion(config[CONF_AUTO_CLOSE_HOLD_ON_MOTION]))
+            cg.add(var.set_auto_close_hold_on_obstruction(config[CONF_AUTO_CLOSE_HOLD_ON_OBSTRUCTION]))
+        if warning := config.get(CONF_WARNING_SEQUENCER):
+            cg.add_define("USE_SECPLUS_GDO_WARNING_SEQUENCER")
+            sequencer = var.warning_sequencer()
+            if CONF_LED_PIN in warning:
+                led_pin = await cg.gpio_pin_expression(warning[CONF_LED_PIN])
+                cg.add(sequencer.set_led_pin(led_pin))
+                cg.add(sequencer.set_led_pattern(warning[CONF_LED_PATTERN]))
+            if CONF_BUZZER_PIN in warning:
+                steps = parse_rtttl(warning[CONF_TONE])
+                tone = cg.static_const_array(
+                    warning[CONF_TONE_DATA_ID], [value for step in steps for value in step]
+                )
+                buzzer_pin = await cg.gpio_pin_expression(warning[CONF_BUZZER_PIN])
+                cg.add(sequencer.set_buzzer_pin(buzzer_pin))
+                cg.add(sequencer.set_tone(tone, len(steps)))
+        for conf in config.get(CONF_ON_POSITION_CROSSED, []):
+            trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], conf[CONF_POSITION], conf[CONF_DIRECTION])
+            await automation.build_automation(trigger, [(cg.float_, "x")], conf)
+            cg.add(var.add_on_position_crossed_trigger(trigger))
+        for conf in config.get(CONF_ON_OPEN_FOR, []):
+            trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], conf[CONF_TIME])
+            await automation.build_automation(trigger, [], conf)
+            cg.add(var.add_on_open_for_trigger(trigger))
+        for conf in config.get(CONF_ON_TRAVEL_COMPLETE, []):
+            trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+            await automation.build_automation(
+                trigger, [(cg.bool_, "opened"), (cg.uint32, "duration_ms")], conf
+            )
+            cg.add(var.add_on_travel_complete_trigger(trigger))
+        for conf in config.get(CONF_ON_OBSTRUCTED_DURING_CLOSE, []):
+            trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
+            await automation.build_automation(trigger, [], conf)
+            cg.add(var.add_on_obstructed_during_close_trigger(trigger))
+
     cg.add(var.set_pre_close_warning_duration(config[CONF_PRE_CLOSE_WARNING_DURATION]))
     for conf in config.get(CONF_PRE_CLOSE_WARNING_START, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
@@ -71,3 +327,36 @@ async def to_code(config):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         await automation.build_automation(trigger, [], conf)
         cg.add(var.register_door_closing_warn_end_trigger(trigger))
+
+
+@automation.register_action(
+    "secplus_gdo.calibrate_travel",
+    CalibrateTravelAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(GDODoor),
+        }
+    ),
+)
+async def secplus_gdo_calibrate_travel_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "secplus_gdo.auto_close_hold",
+    AutoCloseHoldAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(GDODoor),
+            cv.Optional(CONF_HOLD, default=True): cv.templatable(cv.boolean),
+        }
+    ),
+)
+async def secplus_gdo_auto_close_hold_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_HOLD], args, bool)
+    cg.add(var.set_hold(template_))
+    return var
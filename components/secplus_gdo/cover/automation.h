@@ -1,20 +1,63 @@
 #pragma once
 
+#include <cstdint>
+
+#include "esphome/components/cover/cover.h"
 #include "esphome/core/automation.h"
 
 namespace esphome {
 namespace secplus_gdo {
-    class GDODoor;
-
     class CoverClosingStartTrigger : public Trigger<> {
     public:
-        explicit CoverClosingStartTrigger([[maybe_unused]] GDODoor* gdo_door) {}
+        explicit CoverClosingStartTrigger([[maybe_unused]] cover::Cover* door) {}
     };
 
     class CoverClosingEndTrigger : public Trigger<> {
     public:
-        explicit CoverClosingEndTrigger([[maybe_unused]] GDODoor* gdo_door) {}
+        explicit CoverClosingEndTrigger([[maybe_unused]] cover::Cover* door) {}
+    };
+
+    enum class CrossingDirection : uint8_t {
+        ANY = 0,
+        OPENING,
+        CLOSING,
     };
+
+    // Fires with the new position when a reported move passes the threshold in the configured direction.
+    class PositionCrossedTrigger : public Trigger<float> {
+    public:
+        PositionCrossedTrigger(float threshold, CrossingDirection direction)
+            : threshold_(threshold), direction_(direction) {}
+
+        void process(float from, float to) {
+            const bool opening = from < this->threshold_ && to >= this->threshold_;
+            const bool closing = from > this->threshold_ && to <= this->threshold_;
+            if ((opening && this->direction_ != CrossingDirection::CLOSING) ||
+                (closing && this->direction_ != CrossingDirection::OPENING)) {
+                this->trigger(to);
+            }
+        }
+
+    protected:
+        float             threshold_;
+        CrossingDirection direction_;
+    };
+
+    // Fires once the door has been continuously not closed for the configured time.
+    class OpenForTrigger : public Trigger<> {
+    public:
+        explicit OpenForTrigger(uint32_t duration_ms) : duration_ms_(duration_ms) {}
+        uint32_t get_duration() const { return this->duration_ms_; }
+
+    protected:
+        uint32_t duration_ms_;
+    };
+
+    // Fires when a movement reaches its limit, with the direction (true when opened) and the travel time.
+    class TravelCompleteTrigger : public Trigger<bool, uint32_t> {};
+
+    // Fires once per closing movement when the opener reports an obstruction while closing.
+    class ObstructedDuringCloseTrigger : public Trigger<> {};
 } // namespace secplus_gdo
 } // namespace esphome
 
@@ -18,9 +18,15 @@
 
 #include "gdo_door.h"
 
+#ifdef USE_SECPLUS_GDO
+
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <string>
 #include <utility>
 
+#include "../gdo_log.h"
 #include "../secplus_gdo.h"
 #include "esphome/core/log.h"
 #include "inttypes.h"
@@ -28,16 +34,85 @@
 namespace esphome {
 namespace secplus_gdo {
 
+// Covers the pre-close warning plus the slowest openers' travel time.
+static constexpr uint32_t CALIBRATION_LEG_TIMEOUT_MS = 90000;
+// Pause between the two legs so the opener has settled before the next command.
+static constexpr uint32_t CALIBRATION_LEG_GAP_MS = 1000;
+// Toggle-only openers stopped mid-travel: stop after this long, then toggle again after the second delay.
+static constexpr uint32_t RETOGGLE_STOP_MS = 1000;
+static constexpr uint32_t RETOGGLE_MS = 2000;
+// An obstructed close is shown as opening for at most this long unless the opener reports the reversal.
+static constexpr uint32_t REVERSAL_TIMEOUT_MS = 3000;
+
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+void GDODoor::setup() {
+    if (!this->warning_sequencer_.setup()) {
+        this->status_set_warning();
+    }
+}
+#endif
+
+void GDODoor::loop() {
+    this->timers_.poll(millis(), [this](DoorTimer timer) { this->on_timer_(timer); });
+    if (this->timers_.idle()) {
+        this->disable_loop();
+    }
+}
+
+void GDODoor::start_timer_(DoorTimer timer, uint32_t delay_ms) {
+    this->timers_.arm(timer, millis(), delay_ms);
+    this->enable_loop();
+}
+
+void GDODoor::on_timer_(DoorTimer timer) {
+    esp_err_t err;
+    switch (timer) {
+    case DoorTimer::PRE_CLOSE:
+        this->finish_pre_close_();
+        break;
+    case DoorTimer::STOP_DOOR:
+        err = gdo_door_stop();
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "door stop failed: %s", esp_err_to_name(err));
+        }
+        break;
+    case DoorTimer::REOPEN:
+    case DoorTimer::RECLOSE:
+        err = gdo_door_toggle();
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "door %s toggle failed: %s", timer == DoorTimer::REOPEN ? "reopen" : "reclose",
+                     esp_err_to_name(err));
+        }
+        break;
+    case DoorTimer::AUTO_CLOSE:
+        this->auto_close_();
+        break;
+    case DoorTimer::CALIBRATION_TIMEOUT:
+        this->finish_calibration_("timed out");
+        break;
+    case DoorTimer::CALIBRATION_GAP:
+        this->start_calibration_leg_();
+        break;
+    case DoorTimer::REVERSAL_TIMEOUT:
+        this->abandon_reversal_("no reversal reported");
+        if (this->state_ == GDO_DOOR_STATE_CLOSING && !this->has_pre_close_restore_) {
+            this->current_operation = COVER_OPERATION_CLOSING;
+            this->publish_state(false);
+        }
+        break;
+    case DoorTimer::COUNT:
+        break;
+    }
+}
+
 void GDODoor::set_state(gdo_door_state_t state, float position) {
     if (this->pre_close_active_) {
         // If we are in the pre-close state and the door is closing,
         // then it was triggered by something else and we need to cancel the pre-close
         if (state == GDO_DOOR_STATE_CLOSING) {
-            this->cancel_timeout("pre_close");
-            this->pre_close_active_ = false;
-            if (this->pre_close_end_trigger) {
-                this->pre_close_end_trigger->trigger();
-            }
+            this->timers_.cancel(DoorTimer::PRE_CLOSE);
+            this->pre_close_call_.reset();
+            this->end_pre_close_warning_();
             this->clear_pre_close_state_();
         } else {
             // If we are in the pre-close state, and the door is not closing, then do not update
@@ -46,8 +121,16 @@ void GDODoor::set_state(gdo_door_state_t state, float position) {
         }
     }
 
-    ESP_LOGI(TAG, "Door state: %s, position: %.0f%%", gdo_door_state_to_string(state), position * 100.0f);
+    // The warning itself reports CLOSING locally; only the opener's reports count towards calibration.
+    if (!this->has_pre_close_restore_) {
+        this->track_calibration_(state, position);
+        this->track_reversal_(state);
+    }
+
+    GDO_LOGI(LogSubsystem::DOOR, "Door state: %s, position: %.0f%%", gdo_door_state_to_string(state),
+             position * 100.0f);
     this->prev_operation = this->current_operation; // save the previous operation
+    const float prev_position = this->position;
 
     switch (state) {
     case GDO_DOOR_STATE_OPEN:
@@ -63,7 +146,12 @@ void GDODoor::set_state(gdo_door_state_t state, float position) {
         this->position = position;
         break;
     case GDO_DOOR_STATE_CLOSING:
-        this->current_operation = COVER_OPERATION_CLOSING;
+        // Reports still in flight when the obstruction hit do not undo the reversal, but a door that keeps
+        // closing past the point it was obstructed at is not reversing.
+        if (this->reversal_pending_ && position < this->reversal_obstructed_position_) {
+            this->abandon_reversal_("still closing");
+        }
+        this->current_operation = this->reversal_pending_ ? COVER_OPERATION_OPENING : COVER_OPERATION_CLOSING;
         this->position = position;
         break;
     case GDO_DOOR_STATE_STOPPED: // falls through
@@ -74,6 +162,10 @@ void GDODoor::set_state(gdo_door_state_t state, float position) {
         break;
     }
 
+    if (!this->has_pre_close_restore_) {
+        this->process_triggers_(state, prev_position);
+    }
+
 #ifdef USE_MQTT // if MQTT component is enabled, do not publish the same state more than once
     if (this->state_ == state && this->current_operation == this->prev_operation) {
         return;
@@ -82,6 +174,7 @@ void GDODoor::set_state(gdo_door_state_t state, float position) {
 
     this->publish_state(false);
     this->state_ = state;
+    this->update_auto_close_();
 }
 
 bool GDODoor::send_command_(const char *action, std::function<esp_err_t()> &&command) {
@@ -110,6 +203,8 @@ void GDODoor::restore_pre_close_state_() {
     this->current_operation = this->pre_close_restore_operation_;
     this->publish_state(false);
     this->clear_pre_close_state_();
+    // A cancelled warning leaves the door open; count down again if auto-close still applies.
+    this->update_auto_close_();
 }
 
 void GDODoor::clear_pre_close_state_() {
@@ -128,23 +223,41 @@ bool GDODoor::do_action_after_warning(cover::CoverCall call) {
     if (this->pre_close_start_trigger) {
         this->pre_close_start_trigger->trigger();
     }
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+    this->warning_sequencer_.start();
+#endif
 
-    this->set_timeout("pre_close", this->pre_close_duration_, [this, call = std::move(call)]() mutable {
-        this->pre_close_active_ = false;
-        if (this->pre_close_end_trigger) {
-            this->pre_close_end_trigger->trigger();
-        }
-        if (!this->do_action(call)) {
-            this->restore_pre_close_state_();
-        } else {
-            this->clear_pre_close_state_();
-        }
-    });
+    this->pre_close_call_ = std::move(call);
+    this->start_timer_(DoorTimer::PRE_CLOSE, this->pre_close_duration_);
 
     this->pre_close_active_ = true;
     return true;
 }
 
+void GDODoor::end_pre_close_warning_() {
+    this->pre_close_active_ = false;
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+    this->warning_sequencer_.stop();
+#endif
+    if (this->pre_close_end_trigger) {
+        this->pre_close_end_trigger->trigger();
+    }
+}
+
+void GDODoor::finish_pre_close_() {
+    this->end_pre_close_warning_();
+    if (!this->pre_close_call_.has_value()) {
+        return;
+    }
+    const auto call = std::move(*this->pre_close_call_);
+    this->pre_close_call_.reset();
+    if (!this->do_action(call)) {
+        this->restore_pre_close_state_();
+    } else {
+        this->clear_pre_close_state_();
+    }
+}
+
 bool GDODoor::do_action(const cover::CoverCall &call) {
     if (this->parent_) {
         this->parent_->notify_cover_command();
@@ -168,18 +281,8 @@ bool GDODoor::do_action(const cover::CoverCall &call) {
             }
             if (this->state_ == GDO_DOOR_STATE_STOPPED && this->prev_operation == COVER_OPERATION_OPENING) {
                 // If the door was stopped while opening, then we need to toggle to stop, then toggle again to open,
-                this->set_timeout("stop_door", 1000, []() {
-                    const auto err = gdo_door_stop();
-                    if (err != ESP_OK) {
-                        ESP_LOGE(TAG, "door stop failed: %s", esp_err_to_name(err));
-                    }
-                });
-                this->set_timeout("open_door", 2000, []() {
-                    const auto err = gdo_door_toggle();
-                    if (err != ESP_OK) {
-                        ESP_LOGE(TAG, "door reopen toggle failed: %s", esp_err_to_name(err));
-                    }
-                });
+                this->start_timer_(DoorTimer::STOP_DOOR, RETOGGLE_STOP_MS);
+                this->start_timer_(DoorTimer::REOPEN, RETOGGLE_MS);
             }
             return true;
         }
@@ -196,18 +299,8 @@ bool GDODoor::do_action(const cover::CoverCall &call) {
             }
             if (this->state_ == GDO_DOOR_STATE_STOPPED && this->prev_operation == COVER_OPERATION_CLOSING) {
                 // If the door was stopped while closing, then we need to toggle to stop, then toggle again to close,
-                this->set_timeout("stop_door", 1000, []() {
-                    const auto err = gdo_door_stop();
-                    if (err != ESP_OK) {
-                        ESP_LOGE(TAG, "door stop failed: %s", esp_err_to_name(err));
-                    }
-                });
-                this->set_timeout("close_door", 2000, []() {
-                    const auto err = gdo_door_toggle();
-                    if (err != ESP_OK) {
-                        ESP_LOGE(TAG, "door reclose toggle failed: %s", esp_err_to_name(err));
-                    }
-                });
+                this->start_timer_(DoorTimer::STOP_DOOR, RETOGGLE_STOP_MS);
+                this->start_timer_(DoorTimer::RECLOSE, RETOGGLE_MS);
             }
             return true;
         }
@@ -223,6 +316,10 @@ bool GDODoor::do_action(const cover::CoverCall &call) {
 }
 
 void GDODoor::control(const cover::CoverCall &call) {
+    if (this->calibration_leg_ != 0 && !this->calibration_command_) {
+        this->finish_calibration_("interrupted by a cover command");
+    }
+
     if (!this->synced_) {
         ESP_LOGW(TAG, "Ignoring cover command while opener is not synced");
         this->publish_state(false);
@@ -283,11 +380,9 @@ void GDODoor::control(const cover::CoverCall &call) {
         }
 
         ESP_LOGD(TAG, "Canceling pending action");
-        this->cancel_timeout("pre_close");
-        this->pre_close_active_ = false;
-        if (this->pre_close_end_trigger) {
-            this->pre_close_end_trigger->trigger();
-        }
+        this->timers_.cancel(DoorTimer::PRE_CLOSE);
+        this->pre_close_call_.reset();
+        this->end_pre_close_warning_();
         this->restore_pre_close_state_();
     }
 
@@ -329,13 +424,325 @@ void GDODoor::cancel_pre_close_warning() {
     }
 
     ESP_LOGD(TAG, "Canceling pending pre-close warning");
-    this->cancel_timeout("pre_close");
-    this->pre_close_active_ = false;
-    if (this->pre_close_end_trigger) {
-        this->pre_close_end_trigger->trigger();
-    }
+    this->timers_.cancel(DoorTimer::PRE_CLOSE);
+    this->pre_close_call_.reset();
+    this->end_pre_close_warning_();
     this->restore_pre_close_state_();
 }
 
+void GDODoor::process_triggers_(gdo_door_state_t state, float prev_position) {
+    // Positions outside 0..1 are unknown and cannot cross anything.
+    if (prev_position >= COVER_CLOSED && prev_position <= COVER_OPEN && this->position >= COVER_CLOSED &&
+        this->position <= COVER_OPEN) {
+        for (auto *trigger : this->position_crossed_triggers_) {
+            trigger->process(prev_position, this->position);
+        }
+    }
+
+    const bool known = state != GDO_DOOR_STATE_UNKNOWN && state != GDO_DOOR_STATE_MAX;
+    if (state == GDO_DOOR_STATE_CLOSED) {
+        if (this->open_for_running_) {
+            for (size_t i = 0; i < this->open_for_triggers_.size(); i++) {
+                this->cancel_timeout("open_for_" + std::to_string(i));
+            }
+            this->open_for_running_ = false;
+        }
+    } else if (known && !this->open_for_running_) {
+        this->open_for_running_ = true;
+        for (size_t i = 0; i < this->open_for_triggers_.size(); i++) {
+            auto *trigger = this->open_for_triggers_[i];
+            this->set_timeout("open_for_" + std::to_string(i), trigger->get_duration(),
+                              [trigger]() { trigger->trigger(); });
+        }
+    }
+
+    switch (state) {
+    case GDO_DOOR_STATE_OPENING:
+    case GDO_DOOR_STATE_CLOSING: {
+        const bool closing = state == GDO_DOOR_STATE_CLOSING;
+        if (!this->travel_active_ || this->travel_closing_ != closing) {
+            this->travel_active_ = true;
+            this->travel_closing_ = closing;
+            this->travel_obstructed_ = false;
+            this->travel_start_ = millis();
+        }
+        break;
+    }
+    case GDO_DOOR_STATE_OPEN:
+    case GDO_DOOR_STATE_CLOSED:
+        if (this->travel_active_ && this->travel_closing_ == (state == GDO_DOOR_STATE_CLOSED)) {
+            const uint32_t duration_ms = millis() - this->travel_start_;
+            for (auto *trigger : this->travel_complete_triggers_) {
+                trigger->trigger(state == GDO_DOOR_STATE_OPEN, duration_ms);
+            }
+        }
+        this->travel_active_ = false;
+        break;
+    default:
+        this->travel_active_ = false;
+        break;
+    }
+}
+
+void GDODoor::report_obstruction(bool obstructed, uint32_t at_us) {
+    if (obstructed) {
+        // Nothing queued may move the door into the beam: drop the warning and any toggle sequence.
+        this->cancel_pre_close_warning();
+        this->timers_.cancel(DoorTimer::STOP_DOOR);
+        this->timers_.cancel(DoorTimer::REOPEN);
+        this->timers_.cancel(DoorTimer::RECLOSE);
+    }
+
+    if (this->auto_close_hold_on_obstruction_ && obstructed != this->auto_close_obstructed_) {
+        this->auto_close_obstructed_ = obstructed;
+        this->update_auto_close_();
+    }
+
+    // Only a real closing movement counts; the pre-close warning reports CLOSING locally.
+    if (!obstructed || this->state_ != GDO_DOOR_STATE_CLOSING || this->has_pre_close_restore_ ||
+        this->travel_obstructed_) {
+        return;
+    }
+    this->travel_obstructed_ = true;
+
+    // The opener reverses a closing door by itself; show that now instead of at its next position report.
+    this->reversal_pending_ = true;
+    this->reversal_obstructed_us_ = at_us;
+    this->reversal_obstructed_position_ = this->position;
+    this->start_timer_(DoorTimer::REVERSAL_TIMEOUT, REVERSAL_TIMEOUT_MS);
+    this->current_operation = COVER_OPERATION_OPENING;
+    this->publish_state(false);
+    for (auto *trigger : this->obstructed_during_close_triggers_) {
+        trigger->trigger();
+    }
+}
+
+void GDODoor::track_reversal_(gdo_door_state_t state) {
+    if (!this->reversal_pending_ || state == GDO_DOOR_STATE_CLOSING) {
+        return;
+    }
+    this->reversal_pending_ = false;
+    this->timers_.cancel(DoorTimer::REVERSAL_TIMEOUT);
+    if (state != GDO_DOOR_STATE_OPENING && state != GDO_DOOR_STATE_OPEN) {
+        ESP_LOGW(TAG, "Door did not reverse after an obstruction while closing; reported %s",
+                 gdo_door_state_to_string(state));
+        return;
+    }
+
+    // Both times are gdolib or pin timestamps, so deferring the events to the main loop does not count.
+    const uint32_t now_us = this->parent_ != nullptr ? this->parent_->event_time_us() : micros();
+    this->last_reversal_ms_ = (now_us - this->reversal_obstructed_us_) / 1000;
+    GDO_LOGI(LogSubsystem::DOOR, "Door reversed %" PRIu32 " ms after the obstruction", this->last_reversal_ms_);
+    if (this->parent_) {
+        this->parent_->publish_reversal_time(this->last_reversal_ms_);
+    }
+}
+
+void GDODoor::abandon_reversal_(const char *reason) {
+    if (!this->reversal_pending_) {
+        return;
+    }
+    this->reversal_pending_ = false;
+    this->timers_.cancel(DoorTimer::REVERSAL_TIMEOUT);
+    ESP_LOGW(TAG, "Door did not reverse after an obstruction while closing: %s", reason);
+}
+
+void GDODoor::report_motion() {
+    if (this->auto_close_armed_ && this->auto_close_hold_on_motion_) {
+        // Motion in the garage starts the countdown over.
+        this->arm_auto_close_();
+    }
+}
+
+void GDODoor::set_auto_close_hold(bool held) {
+    if (held == this->auto_close_held_) {
+        return;
+    }
+    ESP_LOGD(TAG, "Auto-close %s", held ? "held" : "released");
+    this->auto_close_held_ = held;
+    this->update_auto_close_();
+}
+
+uint32_t GDODoor::auto_close_remaining_ms() const {
+    if (!this->auto_close_armed_) {
+        return 0;
+    }
+    const auto remaining = static_cast<int32_t>(this->auto_close_deadline_ - millis());
+    return remaining > 0 ? remaining : 0;
+}
+
+void GDODoor::update_auto_close_() {
+    // Counts down only while the door rests open or part-open and nothing holds it.
+    const bool resting_open = this->state_ == GDO_DOOR_STATE_OPEN || this->state_ == GDO_DOOR_STATE_STOPPED;
+    const bool wanted = this->auto_close_delay_ > 0 && this->synced_ && resting_open && !this->pre_close_active_ &&
+                        this->calibration_leg_ == 0 && !this->auto_close_held_ && !this->auto_close_obstructed_;
+    if (wanted && !this->auto_close_armed_) {
+        this->arm_auto_close_();
+    } else if (!wanted && this->auto_close_armed_) {
+        this->disarm_auto_close_();
+    }
+}
+
+void GDODoor::arm_auto_close_() {
+    this->auto_close_armed_ = true;
+    this->auto_close_deadline_ = millis() + this->auto_close_delay_;
+    this->start_timer_(DoorTimer::AUTO_CLOSE, this->auto_close_delay_);
+    ESP_LOGD(TAG, "Auto-close in %" PRIu32 " ms", this->auto_close_delay_);
+    if (this->parent_) {
+        this->parent_->publish_auto_close_time(this->auto_close_delay_);
+    }
+}
+
+void GDODoor::disarm_auto_close_() {
+    this->auto_close_armed_ = false;
+    this->timers_.cancel(DoorTimer::AUTO_CLOSE);
+    ESP_LOGD(TAG, "Auto-close cancelled");
+    if (this->parent_) {
+        this->parent_->publish_auto_close_time(0);
+    }
+}
+
+void GDODoor::auto_close_() {
+    this->auto_close_armed_ = false;
+    if (this->parent_) {
+        this->parent_->publish_auto_close_time(0);
+    }
+
+    ESP_LOGI(TAG, "Auto-closing door");
+    // Through the normal cover path so the pre-close warning runs first.
+    this->make_call().set_command_close().perform();
+}
+
+void GDODoor::start_calibration() {
+    if (this->calibration_leg_ != 0) {
+        ESP_LOGW(TAG, "Travel calibration already running");
+        return;
+    }
+    if (!this->synced_) {
+        ESP_LOGW(TAG, "Cannot calibrate travel while opener is not synced");
+        return;
+    }
+    if (this->state_ != GDO_DOOR_STATE_OPEN && this->state_ != GDO_DOOR_STATE_CLOSED) {
+        ESP_LOGW(TAG, "Travel calibration needs the door fully open or closed, not %s",
+                 gdo_door_state_to_string(this->state_));
+        return;
+    }
+
+    ESP_LOGI(TAG, "Starting travel calibration");
+    this->calibration_profiles_[0] = {};
+    this->calibration_profiles_[1] = {};
+    this->calibration_leg_ = 1;
+    this->calibration_closing_ = this->state_ == GDO_DOOR_STATE_OPEN;
+    this->publish_calibration_progress_(0.0f);
+    this->start_calibration_leg_();
+}
+
+void GDODoor::start_calibration_leg_() {
+    this->calibration_moving_ = false;
+    this->start_timer_(DoorTimer::CALIBRATION_TIMEOUT, CALIBRATION_LEG_TIMEOUT_MS);
+
+    // Through the normal cover path so a close gets its pre-close warning.
+    auto call = this->make_call();
+    if (this->calibration_closing_) {
+        call.set_command_close();
+    } else {
+        call.set_command_open();
+    }
+    this->calibration_command_ = true;
+    call.perform();
+    this->calibration_command_ = false;
+}
+
+void GDODoor::track_calibration_(gdo_door_state_t state, float position) {
+    if (this->calibration_leg_ == 0) {
+        return;
+    }
+
+    const auto moving = this->calibration_closing_ ? GDO_DOOR_STATE_CLOSING : GDO_DOOR_STATE_OPENING;
+    const auto reached = this->calibration_closing_ ? GDO_DOOR_STATE_CLOSED : GDO_DOOR_STATE_OPEN;
+    if (state == moving) {
+        if (!this->calibration_moving_) {
+            this->calibration_moving_ = true;
+            this->calibration_leg_start_ = millis();
+            this->publish_calibration_progress_(this->calibration_leg_ == 1 ? 0.25f : 0.75f);
+        }
+        this->record_calibration_sample_(position);
+        return;
+    }
+
+    if (state == reached && this->calibration_moving_) {
+        this->record_calibration_sample_(state == GDO_DOOR_STATE_OPEN ? COVER_OPEN : COVER_CLOSED);
+        auto &profile = this->calibration_profiles_[this->calibration_closing_ ? 1 : 0];
+        profile.duration_ms = millis() - this->calibration_leg_start_;
+        ESP_LOGI(TAG, "Travel calibration: %s took %" PRIu32 " ms", this->calibration_closing_ ? "closing" : "opening",
+                 profile.duration_ms);
+
+        if (this->calibration_leg_ == 2) {
+            this->finish_calibration_(nullptr);
+            return;
+        }
+        this->calibration_leg_ = 2;
+        this->calibration_closing_ = !this->calibration_closing_;
+        this->calibration_moving_ = false;
+        this->publish_calibration_progress_(0.5f);
+        this->timers_.cancel(DoorTimer::CALIBRATION_TIMEOUT);
+        this->start_timer_(DoorTimer::CALIBRATION_GAP, CALIBRATION_LEG_GAP_MS);
+        return;
+    }
+
+    if (this->calibration_moving_ || state == GDO_DOOR_STATE_STOPPED) {
+        // Stopped, reversed, or reached the wrong limit: the timing is no longer a full travel.
+        this->finish_calibration_("door did not complete the travel");
+    }
+}
+
+void GDODoor::record_calibration_sample_(float position) {
+    auto &profile = this->calibration_profiles_[this->calibration_closing_ ? 1 : 0];
+    // Once full, the last slot keeps being overwritten so the profile always ends at the final report.
+    const size_t index = std::min<size_t>(profile.len, TRAVEL_PROFILE_SIZE - 1);
+    profile.samples[index] = {millis() - this->calibration_leg_start_, static_cast<uint8_t>(position * 100.0f)};
+    if (profile.len < TRAVEL_PROFILE_SIZE) {
+        profile.len++;
+    }
+}
+
+void GDODoor::finish_calibration_(const char *failure) {
+    this->timers_.cancel(DoorTimer::CALIBRATION_TIMEOUT);
+    this->timers_.cancel(DoorTimer::CALIBRATION_GAP);
+    this->calibration_leg_ = 0;
+    this->calibration_moving_ = false;
+
+    if (failure != nullptr) {
+        ESP_LOGW(TAG, "Travel calibration aborted: %s", failure);
+        this->publish_calibration_progress_(NAN);
+        return;
+    }
+
+    static constexpr const char *DIRECTIONS[] = {"Opening", "Closing"};
+    for (size_t direction = 0; direction < 2; direction++) {
+        const auto &profile = this->calibration_profiles_[direction];
+        for (uint8_t i = 0; i < profile.len; i++) {
+            ESP_LOGD(TAG, "%s profile: %" PRIu32 " ms at %" PRIu8 "%%", DIRECTIONS[direction], profile.samples[i].ms,
+                     profile.samples[i].percent);
+        }
+    }
+
+    const auto open_ms = this->calibration_profiles_[0].duration_ms;
+    const auto close_ms = this->calibration_profiles_[1].duration_ms;
+    ESP_LOGI(TAG, "Travel calibration complete: open %" PRIu32 " ms, close %" PRIu32 " ms", open_ms, close_ms);
+    if (this->parent_) {
+        this->parent_->apply_travel_calibration(open_ms, close_ms);
+    }
+    this->publish_calibration_progress_(1.0f);
+}
+
+void GDODoor::publish_calibration_progress_(float progress) {
+    if (this->parent_) {
+        this->parent_->publish_calibration_progress(progress * 100.0f);
+    }
+}
+
 } // namespace secplus_gdo
 } // namespace esphome
+
+#endif // USE_SECPLUS_GDO
@@ -18,11 +18,21 @@
 
 #pragma once
 
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO
+
+#include <array>
 #include <functional>
+#include <optional>
+#include <vector>
 
+#include "../timer_wheel.h"
 #include "automation.h"
+#include "warning_sequencer.h"
 #include "esphome/components/cover/cover.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "gdo.h"
 #include "inttypes.h"
@@ -33,12 +43,39 @@ namespace secplus_gdo {
 class GDOComponent;
 
 using namespace esphome::cover;
+
+    // One-shot timers of the cover, serviced from its loop().
+    enum class DoorTimer : uint8_t {
+        PRE_CLOSE,
+        STOP_DOOR,
+        REOPEN,
+        RECLOSE,
+        AUTO_CLOSE,
+        CALIBRATION_TIMEOUT,
+        CALIBRATION_GAP,
+        REVERSAL_TIMEOUT,
+        COUNT,
+    };
+
     class GDODoor : public cover::Cover, public Component {
     public:
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+        void setup() override;
+#endif
+        void loop() override;
         void dump_config() override {
             ESP_LOGCONFIG(TAG, "GDO cover configured");
             ESP_LOGCONFIG(TAG, "  Pre-close warning duration: %" PRIu32 " ms", this->pre_close_duration_);
             ESP_LOGCONFIG(TAG, "  Toggle-only mode: %s", this->toggle_only_ ? "YES" : "NO");
+            if (this->auto_close_delay_ > 0) {
+                ESP_LOGCONFIG(TAG, "  Auto-close delay: %" PRIu32 " ms", this->auto_close_delay_);
+                ESP_LOGCONFIG(TAG, "  Auto-close hold on motion: %s", YESNO(this->auto_close_hold_on_motion_));
+                ESP_LOGCONFIG(TAG, "  Auto-close hold on obstruction: %s",
+                              YESNO(this->auto_close_hold_on_obstruction_));
+            }
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+            this->warning_sequencer_.dump_config();
+#endif
         }
 
         [[nodiscard]] cover::CoverTraits get_traits() override {
@@ -57,7 +94,21 @@ using namespace esphome::cover;
             this->pre_close_end_trigger = trigger;
         }
 
-        void set_sync_state(bool synced) { this->synced_ = synced; }
+        void add_on_position_crossed_trigger(PositionCrossedTrigger *trigger) {
+            this->position_crossed_triggers_.push_back(trigger);
+        }
+        void add_on_open_for_trigger(OpenForTrigger *trigger) { this->open_for_triggers_.push_back(trigger); }
+        void add_on_travel_complete_trigger(TravelCompleteTrigger *trigger) {
+            this->travel_complete_triggers_.push_back(trigger);
+        }
+        void add_on_obstructed_during_close_trigger(ObstructedDuringCloseTrigger *trigger) {
+            this->obstructed_during_close_triggers_.push_back(trigger);
+        }
+
+        void set_sync_state(bool synced) {
+            this->synced_ = synced;
+            this->update_auto_close_();
+        }
 
         bool do_action(const cover::CoverCall &call);
         bool do_action_after_warning(cover::CoverCall call);
@@ -65,15 +116,63 @@ using namespace esphome::cover;
         void set_toggle_only(bool val) { this->toggle_only_ = val; }
         void set_state(gdo_door_state_t state, float position);
         void cancel_pre_close_warning();
+        // Called by the hub for each obstruction and motion report. at_us is the micros() time of the report.
+        void report_obstruction(bool obstructed, uint32_t at_us);
+        void report_motion();
+        void set_auto_close_delay(uint32_t ms) { this->auto_close_delay_ = ms; }
+        void set_auto_close_hold_on_motion(bool hold) { this->auto_close_hold_on_motion_ = hold; }
+        void set_auto_close_hold_on_obstruction(bool hold) { this->auto_close_hold_on_obstruction_ = hold; }
+        // Holds the auto-close countdown until released; releasing starts a full countdown.
+        void set_auto_close_hold(bool held);
+        // 0 when no auto-close is counting down.
+        uint32_t auto_close_remaining_ms() const;
+        // Time from the last obstruction during a close to the opener reporting the reversal; 0 before one.
+        uint32_t last_reversal_ms() const { return this->last_reversal_ms_; }
         void set_parent(GDOComponent *parent) { this->parent_ = parent; }
+        // Runs one full open and close cycle (close and open when starting open), pre-close warning included,
+        // and hands the measured travel times to gdolib.
+        void start_calibration();
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+        // Plays the pre-close warning natively while it runs.
+        WarningSequencer &warning_sequencer() { return this->warning_sequencer_; }
+#endif
 
     protected:
         void control(const cover::CoverCall &call) override;
+        void start_timer_(DoorTimer timer, uint32_t delay_ms);
+        void on_timer_(DoorTimer timer);
+        void finish_pre_close_();
+        void end_pre_close_warning_();
         bool send_command_(const char *action, std::function<esp_err_t()> &&command);
         void remember_pre_close_state_();
         void restore_pre_close_state_();
         void clear_pre_close_state_();
+        void start_calibration_leg_();
+        void track_calibration_(gdo_door_state_t state, float position);
+        void record_calibration_sample_(float position);
+        void finish_calibration_(const char *failure);
+        void publish_calibration_progress_(float progress);
+        void process_triggers_(gdo_door_state_t state, float prev_position);
+        void track_reversal_(gdo_door_state_t state);
+        void abandon_reversal_(const char *reason);
+        void update_auto_close_();
+        void arm_auto_close_();
+        void disarm_auto_close_();
+        void auto_close_();
 
+        struct TravelSample {
+            uint32_t ms;
+            uint8_t  percent;
+        };
+        static constexpr size_t TRAVEL_PROFILE_SIZE = 16;
+        struct TravelProfile {
+            std::array<TravelSample, TRAVEL_PROFILE_SIZE> samples{};
+            uint8_t                                       len{0};
+            uint32_t                                      duration_ms{0};
+        };
+
+        TimerWheel<DoorTimer>     timers_;
+        std::optional<CoverCall>  pre_close_call_;
         CoverClosingStartTrigger *pre_close_start_trigger{nullptr};
         CoverClosingEndTrigger   *pre_close_end_trigger{nullptr};
         uint32_t                  pre_close_duration_{0};
@@ -87,8 +186,51 @@ using namespace esphome::cover;
         float                     pre_close_restore_position_{COVER_OPEN};
         CoverOperation            pre_close_restore_operation_{COVER_OPERATION_IDLE};
         bool                      has_pre_close_restore_{false};
+        uint8_t                   calibration_leg_{0}; // 0 when idle, else 1 or 2
+        bool                      calibration_closing_{false};
+        bool                      calibration_moving_{false};
+        bool                      calibration_command_{false};
+        uint32_t                  calibration_leg_start_{0};
+        TravelProfile             calibration_profiles_[2]; // opening, closing
+        std::vector<PositionCrossedTrigger *>       position_crossed_triggers_;
+        std::vector<OpenForTrigger *>               open_for_triggers_;
+        std::vector<TravelCompleteTrigger *>        travel_complete_triggers_;
+        std::vector<ObstructedDuringCloseTrigger *> obstructed_during_close_triggers_;
+        bool                      open_for_running_{false};
+        bool                      travel_active_{false};
+        bool                      travel_closing_{false};
+        bool                      travel_obstructed_{false};
+        uint32_t                  travel_start_{0};
+        bool                      reversal_pending_{false};
+        uint32_t                  reversal_obstructed_us_{0};
+        float                     reversal_obstructed_position_{COVER_OPEN};
+        uint32_t                  last_reversal_ms_{0};
+        uint32_t                  auto_close_delay_{0}; // 0 when auto-close is off
+        uint32_t                  auto_close_deadline_{0};
+        bool                      auto_close_armed_{false};
+        bool                      auto_close_held_{false};
+        bool                      auto_close_obstructed_{false};
+        bool                      auto_close_hold_on_motion_{true};
+        bool                      auto_close_hold_on_obstruction_{true};
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+        WarningSequencer          warning_sequencer_;
+#endif
         static constexpr const char *TAG = "gdo_cover";
     };
 
+    template<typename... Ts> class CalibrateTravelAction : public Action<Ts...>, public Parented<GDODoor> {
+    public:
+        void play(const Ts &...x) override { this->parent_->start_calibration(); }
+    };
+
+    template<typename... Ts> class AutoCloseHoldAction : public Action<Ts...>, public Parented<GDODoor> {
+    public:
+        TEMPLATABLE_VALUE(bool, hold)
+
+        void play(const Ts &...x) override { this->parent_->set_auto_close_hold(this->hold_.value(x...)); }
+    };
+
 } // namespace secplus_gdo
 } // namespace esphome
+
+#endif // USE_SECPLUS_GDO
@@ -0,0 +1,453 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gdo_dry_contact_door.h"
+
+#ifdef USE_SECPLUS_GDO_DRY_CONTACT
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "inttypes.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+    // Gap between consecutive relay presses, long enough for the opener to register each one.
+    constexpr uint32_t TOGGLE_GAP_MS = 1000;
+    constexpr uint32_t POSITION_PUBLISH_INTERVAL_MS = 500;
+    // Learned travel times outside this range are treated as a stop or reversal, not a full run.
+    constexpr uint32_t MIN_TRAVEL_MS = 2000;
+    constexpr uint32_t MAX_TRAVEL_MS = 60000;
+    constexpr float    LIMIT_WAIT_MARGIN = 0.01f;
+
+    void IRAM_ATTR GDODryContactDoor::edge_isr_(EdgeCapture *edge) {
+        const uint32_t now = micros();
+        if (!edge->pending) {
+            edge->first_us = now;
+        }
+        edge->last_us = now;
+        edge->pending = true;
+    }
+
+    void GDODryContactDoor::setup() {
+        this->setup_sensor_(this->closed_sensor_);
+        if (this->open_sensor_.pin != nullptr) {
+            this->setup_sensor_(this->open_sensor_);
+        }
+
+        this->pref_ = this->make_entity_preference<TravelTimes>();
+        TravelTimes saved{};
+        if (this->pref_.load(&saved) && saved.open_ms >= MIN_TRAVEL_MS && saved.open_ms <= MAX_TRAVEL_MS &&
+            saved.close_ms >= MIN_TRAVEL_MS && saved.close_ms <= MAX_TRAVEL_MS) {
+            this->open_duration_ms_ = saved.open_ms;
+            this->close_duration_ms_ = saved.close_ms;
+        }
+
+        if (this->closed_sensor_.active) {
+            this->position = COVER_CLOSED;
+            this->last_direction_ = COVER_OPERATION_CLOSING;
+        } else {
+            // Without a reading from an open limit the door is assumed to be fully open, as the old template cover did.
+            this->position = COVER_OPEN;
+            this->last_direction_ = COVER_OPERATION_OPENING;
+        }
+        this->current_operation = COVER_OPERATION_IDLE;
+        this->publish_state(false);
+        this->publish_contact_();
+    }
+
+    void GDODryContactDoor::setup_sensor_(LimitSensor &sensor) {
+        sensor.pin->setup();
+        sensor.active = sensor.pin->digital_read();
+        sensor.pin->attach_interrupt(&GDODryContactDoor::edge_isr_, &sensor.edge, gpio::INTERRUPT_ANY_EDGE);
+    }
+
+    void GDODryContactDoor::dump_config() {
+        ESP_LOGCONFIG(TAG, "GDO dry-contact cover configured");
+        LOG_PIN("  Closed sensor pin: ", this->closed_sensor_.pin);
+        if (this->open_sensor_.pin != nullptr) {
+            LOG_PIN("  Open sensor pin: ", this->open_sensor_.pin);
+        }
+        ESP_LOGCONFIG(TAG, "  Debounce: %" PRIu32 " ms", this->debounce_us_ / 1000);
+        ESP_LOGCONFIG(TAG, "  Open travel time: %" PRIu32 " ms", this->open_duration_ms_);
+        ESP_LOGCONFIG(TAG, "  Close travel time: %" PRIu32 " ms", this->close_duration_ms_);
+        ESP_LOGCONFIG(TAG, "  Pre-close warning duration: %" PRIu32 " ms", this->pre_close_duration_);
+    }
+
+    bool GDODryContactDoor::settle_edge_(LimitSensor &sensor, uint32_t *edge_us) {
+        if (!sensor.edge.pending) {
+            return false;
+        }
+
+        uint32_t first_us;
+        {
+            InterruptLock lock;
+            if (micros() - sensor.edge.last_us < this->debounce_us_) {
+                return false;
+            }
+            first_us = sensor.edge.first_us;
+            sensor.edge.pending = false;
+        }
+
+        const bool level = sensor.pin->digital_read();
+        if (level == sensor.active) {
+            // The contact bounced back to where it was.
+            return false;
+        }
+        sensor.active = level;
+        *edge_us = first_us;
+        return true;
+    }
+
+    void GDODryContactDoor::loop() {
+        uint32_t edge_us;
+        if (this->settle_edge_(this->closed_sensor_, &edge_us)) {
+            this->publish_contact_();
+            if (this->closed_sensor_.active) {
+                if (this->current_operation == COVER_OPERATION_CLOSING && this->full_travel_) {
+                    this->learn_travel_time_(&this->close_duration_ms_, this->move_start_us_, edge_us, "close");
+                }
+                this->last_direction_ = COVER_OPERATION_CLOSING;
+                this->target_position_.reset();
+                this->stop_motion_(COVER_CLOSED, edge_us);
+            } else {
+                // Leaving the closed limit means the door is opening, whoever pressed the button.
+                this->start_motion_(COVER_OPERATION_OPENING, COVER_CLOSED, edge_us);
+            }
+        }
+
+        if (this->open_sensor_.pin != nullptr && this->settle_edge_(this->open_sensor_, &edge_us)) {
+            if (this->open_sensor_.active) {
+                if (this->current_operation == COVER_OPERATION_OPENING && this->full_travel_) {
+                    this->learn_travel_time_(&this->open_duration_ms_, this->move_start_us_, edge_us, "open");
+                }
+                this->last_direction_ = COVER_OPERATION_OPENING;
+                this->target_position_.reset();
+                this->stop_motion_(COVER_OPEN, edge_us);
+            } else {
+                this->start_motion_(COVER_OPERATION_CLOSING, COVER_OPEN, edge_us);
+            }
+        }
+
+        if (this->is_moving_()) {
+            this->update_position_(micros());
+        }
+
+        this->timers_.poll(millis(), [this](DryContactTimer timer) { this->on_timer_(timer); });
+    }
+
+    void GDODryContactDoor::on_timer_(DryContactTimer timer) {
+        switch (timer) {
+        case DryContactTimer::PRE_CLOSE:
+            this->finish_pre_close_warning_();
+            this->move_(COVER_OPERATION_CLOSING);
+            break;
+        case DryContactTimer::STOP_DOOR:
+        case DryContactTimer::REVERSE:
+            this->press_();
+            break;
+        case DryContactTimer::CLOSE_AFTER_STOP:
+            this->move_after_warning_(COVER_OPERATION_CLOSING);
+            break;
+        case DryContactTimer::COUNT:
+            break;
+        }
+    }
+
+    void GDODryContactDoor::cancel_relay_timers_() {
+        this->timers_.cancel(DryContactTimer::STOP_DOOR);
+        this->timers_.cancel(DryContactTimer::REVERSE);
+        this->timers_.cancel(DryContactTimer::CLOSE_AFTER_STOP);
+    }
+
+    CoverOperation GDODryContactDoor::next_direction_() const {
+        if (this->position <= COVER_CLOSED) {
+            return COVER_OPERATION_OPENING;
+        }
+        if (this->position >= COVER_OPEN) {
+            return COVER_OPERATION_CLOSING;
+        }
+        // Stopped part way: the opener reverses the direction it was last moving in.
+        return this->last_direction_ == COVER_OPERATION_OPENING ? COVER_OPERATION_CLOSING : COVER_OPERATION_OPENING;
+    }
+
+    void GDODryContactDoor::press_() {
+        if (this->opener_button_ == nullptr) {
+            return;
+        }
+
+        this->opener_button_->press();
+        const uint32_t now_us = micros();
+        if (this->is_moving_()) {
+            this->stop_motion_(this->estimate_position_(now_us), now_us);
+        } else {
+            this->start_motion_(this->next_direction_(), this->position, now_us);
+        }
+    }
+
+    void GDODryContactDoor::start_motion_(CoverOperation direction, float from, uint32_t start_us) {
+        if (this->pre_close_active_) {
+            // Something other than this cover moved the door; the pending close no longer applies.
+            this->timers_.cancel(DryContactTimer::PRE_CLOSE);
+            this->finish_pre_close_warning_();
+        }
+
+        ESP_LOGD(TAG, "Door %s from %.0f%%", direction == COVER_OPERATION_OPENING ? "opening" : "closing",
+                 from * 100.0f);
+        this->current_operation = direction;
+        this->last_direction_ = direction;
+        this->position = from;
+        this->move_start_position_ = from;
+        this->move_start_us_ = start_us;
+        this->full_travel_ = (direction == COVER_OPERATION_OPENING && from == COVER_CLOSED) ||
+                             (direction == COVER_OPERATION_CLOSING && from == COVER_OPEN);
+        this->publish_state(false);
+        this->last_publish_ms_ = millis();
+    }
+
+    void GDODryContactDoor::stop_motion_(float position, uint32_t now_us) {
+        ESP_LOGD(TAG, "Door stopped at %.0f%% after %" PRIu32 " ms", position * 100.0f,
+                 (now_us - this->move_start_us_) / 1000);
+        this->position = position;
+        this->current_operation = COVER_OPERATION_IDLE;
+        this->publish_state(false);
+        this->last_publish_ms_ = millis();
+    }
+
+    float GDODryContactDoor::estimate_position_(uint32_t now_us) const {
+        const float elapsed_ms = static_cast<float>((now_us - this->move_start_us_) / 1000);
+        float position = this->move_start_position_;
+        if (this->current_operation == COVER_OPERATION_OPENING) {
+            position += elapsed_ms / static_cast<float>(this->open_duration_ms_);
+        } else if (this->current_operation == COVER_OPERATION_CLOSING) {
+            position -= elapsed_ms / static_cast<float>(this->close_duration_ms_);
+        }
+        return clamp(position, COVER_CLOSED, COVER_OPEN);
+    }
+
+    void GDODryContactDoor::update_position_(uint32_t now_us) {
+        const bool opening = this->current_operation == COVER_OPERATION_OPENING;
+        float position = this->estimate_position_(now_us);
+
+        if (this->target_position_.has_value() &&
+            (opening ? position >= *this->target_position_ : position <= *this->target_position_)) {
+            ESP_LOGD(TAG, "Reached target position %.0f%%", *this->target_position_ * 100.0f);
+            this->target_position_.reset();
+            this->press_();
+            return;
+        }
+
+        const uint32_t elapsed_ms = (now_us - this->move_start_us_) / 1000;
+        const uint32_t expected_ms = static_cast<uint32_t>(
+            opening ? (COVER_OPEN - this->move_start_position_) * static_cast<float>(this->open_duration_ms_)
+                    : this->move_start_position_ * static_cast<float>(this->close_duration_ms_));
+        if (elapsed_ms >= expected_ms) {
+            if (opening && this->open_sensor_.pin == nullptr) {
+                // No open limit to wait for; the estimate is all there is.
+                this->target_position_.reset();
+                this->stop_motion_(COVER_OPEN, now_us);
+                return;
+            }
+
+            if (elapsed_ms > expected_ms + expected_ms / 2 + this->debounce_us_ / 1000) {
+                // The limit never came. The opener either stopped on its own or reversed after an obstruction,
+                // which leaves it open with the next press closing it again.
+                ESP_LOGW(TAG, "Door did not reach the %s limit within %" PRIu32 " ms; assuming it is open",
+                         opening ? "open" : "closed", elapsed_ms);
+                this->last_direction_ = COVER_OPERATION_OPENING;
+                this->target_position_.reset();
+                this->stop_motion_(COVER_OPEN, now_us);
+                return;
+            }
+
+            // Hold just short of the limit until its sensor confirms the end of travel.
+            position = opening ? COVER_OPEN - LIMIT_WAIT_MARGIN : COVER_CLOSED + LIMIT_WAIT_MARGIN;
+        }
+
+        this->position = position;
+        const uint32_t now = millis();
+        if (now - this->last_publish_ms_ >= POSITION_PUBLISH_INTERVAL_MS) {
+            this->publish_state(false);
+            this->last_publish_ms_ = now;
+        }
+    }
+
+    void GDODryContactDoor::learn_travel_time_(uint32_t *duration_ms, uint32_t start_us, uint32_t end_us,
+                                               const char *name) {
+        const uint32_t measured_ms = (end_us - start_us) / 1000;
+        if (measured_ms < MIN_TRAVEL_MS || measured_ms > MAX_TRAVEL_MS) {
+            ESP_LOGD(TAG, "Ignoring %s travel time of %" PRIu32 " ms", name, measured_ms);
+            return;
+        }
+
+        *duration_ms = (*duration_ms + measured_ms) / 2;
+        ESP_LOGD(TAG, "Measured %s travel time %" PRIu32 " ms; now using %" PRIu32 " ms", name, measured_ms,
+                 *duration_ms);
+        TravelTimes times{this->open_duration_ms_, this->close_duration_ms_};
+        this->pref_.save(&times);
+    }
+
+    void GDODryContactDoor::publish_contact_() {
+#ifdef USE_BINARY_SENSOR
+        if (this->contact_sensor_ != nullptr) {
+            this->contact_sensor_->publish_state(!this->closed_sensor_.active);
+        }
+#endif
+    }
+
+    void GDODryContactDoor::move_(CoverOperation direction) {
+        if (this->is_moving_()) {
+            if (this->current_operation == direction) {
+                return;
+            }
+            // One press stops the door; the next runs it the other way.
+            this->press_();
+            this->timers_.arm(DryContactTimer::REVERSE, millis(), TOGGLE_GAP_MS);
+            return;
+        }
+
+        this->press_();
+        if (this->current_operation != direction) {
+            // Stopped part way with the cycle pointing the other way: stop the door again, then reverse it.
+            const uint32_t now = millis();
+            this->timers_.arm(DryContactTimer::STOP_DOOR, now, TOGGLE_GAP_MS);
+            this->timers_.arm(DryContactTimer::REVERSE, now, 2 * TOGGLE_GAP_MS);
+        }
+    }
+
+    void GDODryContactDoor::move_after_warning_(CoverOperation direction) {
+        if (direction != COVER_OPERATION_CLOSING || this->pre_close_duration_ == 0) {
+            this->move_(direction);
+            return;
+        }
+
+        if (this->pre_close_active_) {
+            return;
+        }
+
+        this->pre_close_restore_operation_ = this->current_operation;
+        this->current_operation = COVER_OPERATION_CLOSING;
+        this->pre_close_active_ = true;
+        this->publish_state(false);
+
+        ESP_LOGD(TAG, "WARNING for %" PRIu32 "ms", this->pre_close_duration_);
+        if (this->pre_close_start_trigger) {
+            this->pre_close_start_trigger->trigger();
+        }
+
+        this->timers_.arm(DryContactTimer::PRE_CLOSE, millis(), this->pre_close_duration_);
+    }
+
+    void GDODryContactDoor::finish_pre_close_warning_() {
+        this->pre_close_active_ = false;
+        this->current_operation = this->pre_close_restore_operation_;
+        if (this->pre_close_end_trigger) {
+            this->pre_close_end_trigger->trigger();
+        }
+    }
+
+    void GDODryContactDoor::cancel_pre_close_warning() {
+        if (!this->pre_close_active_) {
+            return;
+        }
+
+        ESP_LOGD(TAG, "Canceling pending pre-close warning");
+        this->timers_.cancel(DryContactTimer::PRE_CLOSE);
+        this->finish_pre_close_warning_();
+        this->publish_state(false);
+    }
+
+    void GDODryContactDoor::control(const cover::CoverCall &call) {
+        if (call.get_stop()) {
+            ESP_LOGD(TAG, "Stop command received");
+            this->cancel_pre_close_warning();
+            this->cancel_relay_timers_();
+            this->target_position_.reset();
+            if (this->is_moving_()) {
+                this->press_();
+            } else {
+                this->publish_state(false);
+            }
+            return;
+        }
+
+        if (call.get_toggle()) {
+            ESP_LOGD(TAG, "Toggle command received");
+            this->target_position_.reset();
+            if (this->pre_close_active_) {
+                this->cancel_pre_close_warning();
+            } else if (this->is_moving_()) {
+                this->press_();
+            } else {
+                this->move_after_warning_(this->next_direction_());
+            }
+            return;
+        }
+
+        if (!call.get_position().has_value()) {
+            return;
+        }
+
+        auto pos = *call.get_position();
+        if (!this->is_moving_() && !this->pre_close_active_ && this->position == pos) {
+            ESP_LOGD(TAG, "Door is already at %.0f%%", pos * 100.0f);
+            this->publish_state(false);
+            return;
+        }
+
+        const auto direction = pos > this->position ? COVER_OPERATION_OPENING : COVER_OPERATION_CLOSING;
+        if (pos == COVER_OPEN || pos == COVER_CLOSED) {
+            // The limit sensors (or the travel estimate) end these moves.
+            this->target_position_.reset();
+        } else {
+            this->target_position_ = pos;
+        }
+
+        if (this->is_moving_() && this->current_operation == direction) {
+            ESP_LOGD(TAG, "Door is already moving in target direction; target position: %.0f%%", pos * 100.0f);
+            return;
+        }
+
+        if (this->pre_close_active_) {
+            if (direction == COVER_OPERATION_CLOSING) {
+                ESP_LOGD(TAG, "Door is already closing");
+                return;
+            }
+            this->cancel_pre_close_warning();
+        }
+
+        this->cancel_relay_timers_();
+        if (direction == COVER_OPERATION_OPENING) {
+            ESP_LOGD(TAG, "Opening to %.0f%%", pos * 100.0f);
+            this->move_(COVER_OPERATION_OPENING);
+            return;
+        }
+
+        ESP_LOGD(TAG, "Closing to %.0f%% after warning", pos * 100.0f);
+        if (this->is_moving_()) {
+            // Stop first so the warning runs with the door at rest; the close press follows a full gap later.
+            this->press_();
+            this->timers_.arm(DryContactTimer::CLOSE_AFTER_STOP, millis(), TOGGLE_GAP_MS);
+            return;
+        }
+        this->move_after_warning_(COVER_OPERATION_CLOSING);
+    }
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_DRY_CONTACT
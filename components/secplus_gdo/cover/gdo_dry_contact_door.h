@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_DRY_CONTACT
+
+#include "../timer_wheel.h"
+#include "automation.h"
+#include "esphome/components/button/button.h"
+#include "esphome/components/cover/cover.h"
+#include "esphome/core/component.h"
+#include "esphome/core/gpio.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+#include "inttypes.h"
+
+#ifdef USE_BINARY_SENSOR
+#include "esphome/components/binary_sensor/binary_sensor.h"
+#endif
+
+namespace esphome {
+namespace secplus_gdo {
+
+using namespace esphome::cover;
+
+    // One-shot timers of the dry-contact cover, serviced from its loop().
+    enum class DryContactTimer : uint8_t {
+        PRE_CLOSE,
+        STOP_DOOR,
+        REVERSE,
+        CLOSE_AFTER_STOP,
+        COUNT,
+    };
+
+    // Cover for an opener that is driven through a momentary dry-contact relay. The opener only understands
+    // a single toggle input, so the cover tracks the opener's open -> stop -> close -> stop cycle itself and
+    // estimates the position between the limit sensors from learned travel times.
+    class GDODryContactDoor : public cover::Cover, public Component {
+    public:
+        void setup() override;
+        void loop() override;
+        void dump_config() override;
+        float get_setup_priority() const override { return setup_priority::DATA; }
+
+        [[nodiscard]] cover::CoverTraits get_traits() override {
+            CoverTraits traits;
+            traits.set_supports_stop(true);
+            traits.set_supports_toggle(true);
+            traits.set_supports_position(true);
+            return traits;
+        }
+
+        void register_door_closing_warn_start_trigger(CoverClosingStartTrigger *trigger) {
+            this->pre_close_start_trigger = trigger;
+        }
+
+        void register_door_closing_warn_end_trigger(CoverClosingEndTrigger *trigger) {
+            this->pre_close_end_trigger = trigger;
+        }
+
+        void set_opener_button(button::Button *button) { this->opener_button_ = button; }
+        void set_closed_sensor_pin(InternalGPIOPin *pin) { this->closed_sensor_.pin = pin; }
+        void set_open_sensor_pin(InternalGPIOPin *pin) { this->open_sensor_.pin = pin; }
+#ifdef USE_BINARY_SENSOR
+        void set_contact_sensor(binary_sensor::BinarySensor *sensor) { this->contact_sensor_ = sensor; }
+#endif
+        void set_debounce(uint32_t ms) { this->debounce_us_ = ms * 1000; }
+        void set_open_duration(uint32_t ms) { this->open_duration_ms_ = ms; }
+        void set_close_duration(uint32_t ms) { this->close_duration_ms_ = ms; }
+        void set_pre_close_warning_duration(uint32_t ms) { this->pre_close_duration_ = ms; }
+        void cancel_pre_close_warning();
+
+    protected:
+        // Raw edge capture filled in by the pin interrupt. The first timestamp of a burst of edges is kept so a
+        // debounced transition is dated when the contact actually moved, not when the bouncing stopped.
+        struct EdgeCapture {
+            volatile uint32_t first_us{0};
+            volatile uint32_t last_us{0};
+            volatile bool     pending{false};
+        };
+
+        struct LimitSensor {
+            InternalGPIOPin *pin{nullptr};
+            EdgeCapture      edge;
+            bool             active{false};
+        };
+
+        struct TravelTimes {
+            uint32_t open_ms;
+            uint32_t close_ms;
+        };
+
+        static void edge_isr_(EdgeCapture *edge);
+
+        void control(const cover::CoverCall &call) override;
+        void on_timer_(DryContactTimer timer);
+        void cancel_relay_timers_();
+        void setup_sensor_(LimitSensor &sensor);
+        bool settle_edge_(LimitSensor &sensor, uint32_t *edge_us);
+        void press_();
+        void move_(CoverOperation direction);
+        void move_after_warning_(CoverOperation direction);
+        CoverOperation next_direction_() const;
+        bool is_moving_() const { return this->current_operation != COVER_OPERATION_IDLE && !this->pre_close_active_; }
+        void start_motion_(CoverOperation direction, float from, uint32_t start_us);
+        void stop_motion_(float position, uint32_t now_us);
+        float estimate_position_(uint32_t now_us) const;
+        void update_position_(uint32_t now_us);
+        void learn_travel_time_(uint32_t *duration_ms, uint32_t start_us, uint32_t end_us, const char *name);
+        void publish_contact_();
+        void finish_pre_close_warning_();
+
+        CoverClosingStartTrigger   *pre_close_start_trigger{nullptr};
+        CoverClosingEndTrigger     *pre_close_end_trigger{nullptr};
+        uint32_t                    pre_close_duration_{0};
+        bool                        pre_close_active_{false};
+        CoverOperation              pre_close_restore_operation_{COVER_OPERATION_IDLE};
+        button::Button             *opener_button_{nullptr};
+#ifdef USE_BINARY_SENSOR
+        binary_sensor::BinarySensor *contact_sensor_{nullptr};
+#endif
+        LimitSensor                 closed_sensor_;
+        LimitSensor                 open_sensor_;
+        uint32_t                    debounce_us_{50000};
+        uint32_t                    open_duration_ms_{15000};
+        uint32_t                    close_duration_ms_{15000};
+        ESPPreferenceObject         pref_;
+        CoverOperation              last_direction_{COVER_OPERATION_CLOSING};
+        float                       move_start_position_{COVER_CLOSED};
+        uint32_t                    move_start_us_{0};
+        bool                        full_travel_{false};
+        optional<float>             target_position_{};
+        uint32_t                    last_publish_ms_{0};
+        TimerWheel<DryContactTimer> timers_;
+        static constexpr const char *TAG = "gdo_cover.dry_contact";
+    };
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_DRY_CONTACT
@@ -0,0 +1,76 @@
+"""
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ """
+
+# Turns an RTTTL song into the (frequency Hz, duration ms) steps the warning sequencer plays, so the device
+# never parses the song. Kept free of ESPHome imports so it can be tested on its own.
+
+import re
+
+MAX_STEPS = 256
+NOTE_SEMITONES = {"c": 0, "d": 2, "e": 4, "f": 5, "g": 7, "a": 9, "b": 11, "h": 11}
+NOTE_PATTERN = re.compile(r"^(\d*)([a-hp])(#?)(\.?)(\d?)(\.?)$")
+VALID_DURATIONS = (1, 2, 4, 8, 16, 32)
+
+
+def note_frequency(semitone, octave):
+    # Equal temperament from A4 = 440 Hz.
+    return round(440.0 * 2.0 ** ((semitone - 9) / 12.0 + (octave - 4)))
+
+
+def parse_rtttl(song):
+    """Returns the song as a list of (frequency, ms) pairs, frequency 0 for a rest. Raises ValueError."""
+    parts = song.replace(" ", "").lower().split(":")
+    if len(parts) != 3:
+        raise ValueError("RTTTL needs name:defaults:notes")
+    _, defaults, notes = parts
+
+    settings = {"d": 4, "o": 6, "b": 63}
+    for item in filter(None, defaults.split(",")):
+        key, _, value = item.partition("=")
+        if key not in settings or not value.isdigit():
+            raise ValueError(f"Unknown RTTTL default '{item}'")
+        settings[key] = int(value)
+    if settings["d"] not in VALID_DURATIONS or settings["b"] == 0:
+        raise ValueError("RTTTL default duration or tempo is out of range")
+    whole_ms = 60000 * 4 / settings["b"]
+
+    steps = []
+    for note in filter(None, notes.split(",")):
+        match = NOTE_PATTERN.match(note)
+        if match is None:
+            raise ValueError(f"Cannot parse RTTTL note '{note}'")
+        duration, letter, sharp, dot, octave, dot_after = match.groups()
+        duration = int(duration) if duration else settings["d"]
+        if duration not in VALID_DURATIONS:
+            raise ValueError(f"RTTTL note '{note}' has an invalid duration")
+        ms = whole_ms / duration * (1.5 if dot or dot_after else 1.0)
+        if letter == "p":
+            frequency = 0
+        else:
+            octave = int(octave) if octave else settings["o"]
+            if not 3 <= octave <= 8:
+                raise ValueError(f"RTTTL note '{note}' is outside octaves 3 to 8")
+            frequency = note_frequency(NOTE_SEMITONES[letter] + (1 if sharp else 0), octave)
+        steps.append((frequency, min(max(int(ms + 0.5), 1), 0xFFFF)))
+
+    if not steps:
+        raise ValueError("RTTTL song has no notes")
+    if len(steps) > MAX_STEPS:
+        raise ValueError(f"RTTTL song has more than {MAX_STEPS} notes")
+    return steps
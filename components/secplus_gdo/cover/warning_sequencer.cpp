@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "warning_sequencer.h"
+
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+
+#include <array>
+#include <initializer_list>
+
+#include "esp_err.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+    static constexpr char TAG[] = "gdo_cover.warning";
+    // Carrier for the LED until a tone sets the shared timer's frequency.
+    static constexpr uint32_t LED_FREQUENCY_HZ = 1000;
+    static constexpr uint32_t DUTY_HALF = (WarningSequencer::DUTY_MAX + 1) / 2;
+
+    // Matches the light strobe effect the YAML packages use: 500 ms on, 500 ms off.
+    static constexpr uint16_t STROBE_STEPS[] = {WarningSequencer::DUTY_MAX, 500, 0, 500};
+    static constexpr uint16_t BLINK_STEPS[] = {WarningSequencer::DUTY_MAX, 100, 0, 100};
+
+    // One second up and down in 50 ms steps, squared so the brightness looks even.
+    static constexpr size_t PULSE_HALF_STEPS = 10;
+    static constexpr std::array<uint16_t, PULSE_HALF_STEPS * 4> make_pulse_steps() {
+        std::array<uint16_t, PULSE_HALF_STEPS * 4> steps{};
+        for (size_t i = 0; i < PULSE_HALF_STEPS * 2; i++) {
+            const size_t level = i < PULSE_HALF_STEPS ? i : PULSE_HALF_STEPS * 2 - i;
+            steps[i * 2] = WarningSequencer::DUTY_MAX * level * level / (PULSE_HALF_STEPS * PULSE_HALF_STEPS);
+            steps[i * 2 + 1] = 50;
+        }
+        return steps;
+    }
+    static constexpr auto PULSE_STEPS = make_pulse_steps();
+
+    void WarningSequencer::set_led_pattern(WarningLedPattern pattern) {
+        this->led_pattern_ = pattern;
+        switch (pattern) {
+        case WarningLedPattern::STROBE:
+            this->led_.steps = STROBE_STEPS;
+            this->led_.len = sizeof(STROBE_STEPS) / sizeof(STROBE_STEPS[0]) / 2;
+            break;
+        case WarningLedPattern::BLINK:
+            this->led_.steps = BLINK_STEPS;
+            this->led_.len = sizeof(BLINK_STEPS) / sizeof(BLINK_STEPS[0]) / 2;
+            break;
+        case WarningLedPattern::PULSE:
+            this->led_.steps = PULSE_STEPS.data();
+            this->led_.len = PULSE_STEPS.size() / 2;
+            break;
+        }
+    }
+
+    bool WarningSequencer::setup() {
+        if (this->led_.pin == nullptr && this->buzzer_.pin == nullptr) {
+            return true;
+        }
+
+        ledc_timer_config_t timer_config{};
+        timer_config.speed_mode = SPEED_MODE;
+        timer_config.duty_resolution = LEDC_TIMER_10_BIT;
+        timer_config.timer_num = TIMER;
+        timer_config.freq_hz = LED_FREQUENCY_HZ;
+        timer_config.clk_cfg = LEDC_AUTO_CLK;
+        const auto err = ledc_timer_config(&timer_config);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to configure LEDC timer %d: %s", TIMER, esp_err_to_name(err));
+            return false;
+        }
+
+        if (this->led_.pin != nullptr && !this->setup_track_(this->led_, LED_CHANNEL, false, "gdo_warning_led")) {
+            return false;
+        }
+        if (this->buzzer_.pin != nullptr &&
+            !this->setup_track_(this->buzzer_, BUZZER_CHANNEL, true, "gdo_warning_tone")) {
+            return false;
+        }
+        this->ready_ = true;
+        return true;
+    }
+
+    bool WarningSequencer::setup_track_(Track &track, ledc_channel_t channel, bool tone, const char *name) {
+        track.parent = this;
+        track.channel = channel;
+        track.tone = tone;
+
+        ledc_channel_config_t channel_config{};
+        channel_config.gpio_num = track.pin->get_pin();
+        channel_config.speed_mode = SPEED_MODE;
+        channel_config.channel = channel;
+        channel_config.timer_sel = TIMER;
+        channel_config.duty = 0;
+        channel_config.hpoint = 0;
+        channel_config.flags.output_invert = track.pin->is_inverted();
+        auto err = ledc_channel_config(&channel_config);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to configure LEDC channel %d on GPIO%d: %s", channel, track.pin->get_pin(),
+                     esp_err_to_name(err));
+            return false;
+        }
+
+        esp_timer_create_args_t timer_args{};
+        timer_args.callback = &WarningSequencer::on_timer_;
+        timer_args.arg = &track;
+        timer_args.dispatch_method = ESP_TIMER_TASK;
+        timer_args.name = name;
+        err = esp_timer_create(&timer_args, &track.timer);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to create %s timer: %s", name, esp_err_to_name(err));
+            return false;
+        }
+        return true;
+    }
+
+    void WarningSequencer::dump_config() const {
+        static constexpr const char *PATTERNS[] = {"strobe", "blink", "pulse"};
+        if (this->led_.pin != nullptr) {
+            ESP_LOGCONFIG(TAG, "  Warning LED: GPIO%d, %s, LEDC channel %d", this->led_.pin->get_pin(),
+                          PATTERNS[static_cast<uint8_t>(this->led_pattern_)], LED_CHANNEL);
+        }
+        if (this->buzzer_.pin != nullptr) {
+            ESP_LOGCONFIG(TAG, "  Warning buzzer: GPIO%d, %u notes, LEDC channel %d", this->buzzer_.pin->get_pin(),
+                          static_cast<unsigned>(this->buzzer_.len), BUZZER_CHANNEL);
+        }
+        if (this->led_.pin != nullptr || this->buzzer_.pin != nullptr) {
+            ESP_LOGCONFIG(TAG, "  Warning LEDC timer: %d%s", TIMER, this->ready_ ? "" : ", setup failed");
+        }
+    }
+
+    void WarningSequencer::start() {
+        if (!this->ready_) {
+            return;
+        }
+        this->running_ = true;
+        for (auto *track : {&this->led_, &this->buzzer_}) {
+            if (track->timer != nullptr && track->len > 0) {
+                esp_timer_stop(track->timer);
+                track->index = 0;
+                this->step_(*track);
+            }
+        }
+    }
+
+    void WarningSequencer::stop() {
+        this->running_ = false;
+        if (!this->ready_) {
+            return;
+        }
+        for (auto *track : {&this->led_, &this->buzzer_}) {
+            if (track->timer != nullptr) {
+                esp_timer_stop(track->timer);
+                this->silence_(*track);
+            }
+        }
+    }
+
+    void WarningSequencer::on_timer_(void *arg) {
+        auto *track = static_cast<Track *>(arg);
+        track->parent->step_(*track);
+    }
+
+    // Runs in the esp_timer task except for the first step, which start() plays right away.
+    void WarningSequencer::step_(Track &track) {
+        if (!this->running_) {
+            return;
+        }
+        const uint16_t value = track.steps[track.index * 2];
+        const uint16_t ms = track.steps[track.index * 2 + 1];
+        track.index = (track.index + 1) % track.len;
+
+        uint32_t duty = value;
+        if (track.tone) {
+            duty = value != 0 ? DUTY_HALF : 0;
+            if (value != 0) {
+                ledc_set_freq(SPEED_MODE, TIMER, value);
+            }
+        }
+        ledc_set_duty(SPEED_MODE, track.channel, duty);
+        ledc_update_duty(SPEED_MODE, track.channel);
+
+        // stop() clears running_ before silencing the outputs, so a step that raced it is undone here.
+        if (!this->running_) {
+            this->silence_(track);
+            return;
+        }
+        esp_timer_start_once(track.timer, uint64_t{ms} * 1000);
+    }
+
+    void WarningSequencer::silence_(Track &track) { ledc_stop(SPEED_MODE, track.channel, 0); }
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_WARNING_SEQUENCER
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_WARNING_SEQUENCER
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "driver/ledc.h"
+#include "esp_timer.h"
+#include "esphome/core/gpio.h"
+#include "esphome/core/hal.h"
+#include "soc/soc_caps.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+    enum class WarningLedPattern : uint8_t {
+        STROBE,
+        BLINK,
+        PULSE,
+    };
+
+    // Plays the pre-close warning on LEDC hardware: an LED pattern and a tone, each a looping table of
+    // (value, ms) steps. Each track steps from its own esp_timer, so nothing runs in the main loop, and
+    // stop() silences both outputs before returning.
+    //
+    // Both channels share the last LEDC timer; ESPHome's ledc outputs only use it on the same two channels,
+    // which the cover config rejects. The LED duty is a fraction of the period, so the tone frequency does
+    // not change it.
+    class WarningSequencer {
+    public:
+        static constexpr ledc_mode_t SPEED_MODE = LEDC_LOW_SPEED_MODE;
+        static constexpr ledc_timer_t TIMER = static_cast<ledc_timer_t>(LEDC_TIMER_MAX - 1);
+        static constexpr ledc_channel_t LED_CHANNEL = static_cast<ledc_channel_t>(SOC_LEDC_CHANNEL_NUM - 1);
+        static constexpr ledc_channel_t BUZZER_CHANNEL = static_cast<ledc_channel_t>(SOC_LEDC_CHANNEL_NUM - 2);
+        static constexpr uint32_t DUTY_MAX = (1 << 10) - 1;
+
+        void set_led_pin(InternalGPIOPin *pin) { this->led_.pin = pin; }
+        void set_led_pattern(WarningLedPattern pattern);
+        void set_buzzer_pin(InternalGPIOPin *pin) { this->buzzer_.pin = pin; }
+        // Flat (Hz, ms) pairs generated from the configured RTTTL song; 0 Hz is a rest.
+        void set_tone(const uint16_t *steps, size_t len) {
+            this->buzzer_.steps = steps;
+            this->buzzer_.len = len;
+        }
+
+        bool setup();
+        void dump_config() const;
+        // Restarts both tracks from their first step.
+        void start();
+        void stop();
+        bool running() const { return this->running_.load(); }
+
+    protected:
+        struct Track {
+            WarningSequencer  *parent{nullptr};
+            const uint16_t    *steps{nullptr}; // (value, ms) pairs
+            size_t             len{0};         // pairs
+            size_t             index{0};
+            esp_timer_handle_t timer{nullptr};
+            ledc_channel_t     channel{LEDC_CHANNEL_0};
+            InternalGPIOPin   *pin{nullptr};
+            bool               tone{false};
+        };
+
+        bool setup_track_(Track &track, ledc_channel_t channel, bool tone, const char *name);
+        void step_(Track &track);
+        void silence_(Track &track);
+        static void on_timer_(void *arg);
+
+        Track             led_;
+        Track             buzzer_;
+        std::atomic<bool> running_{false};
+        bool              ready_{false};
+        WarningLedPattern led_pattern_{WarningLedPattern::STROBE};
+    };
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_WARNING_SEQUENCER
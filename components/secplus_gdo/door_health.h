@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Streaming estimate of one quantile with the P-square algorithm (Jain and Chlamtac): five markers whose
+// heights track the minimum, p/2, p, (1+p)/2 and maximum quantiles, so memory stays fixed however many
+// samples are added. Plain data so it can be saved to flash as is.
+struct P2Quantile {
+    std::array<float, 5>   heights{};
+    std::array<int32_t, 5> positions{};
+    std::array<float, 5>   desired{};
+    uint32_t               count{0};
+
+    void add(float x, float p) {
+        if (this->count < 5) {
+            this->heights[this->count++] = x;
+            if (this->count == 5) {
+                std::sort(this->heights.begin(), this->heights.end());
+                for (int32_t i = 0; i < 5; i++) {
+                    this->positions[i] = i;
+                }
+                this->desired = {0.0f, 2.0f * p, 4.0f * p, 2.0f + 2.0f * p, 4.0f};
+            }
+            return;
+        }
+
+        int k;
+        if (x < this->heights[0]) {
+            this->heights[0] = x;
+            k = 0;
+        } else if (x >= this->heights[4]) {
+            this->heights[4] = x;
+            k = 3;
+        } else {
+            k = 0;
+            while (x >= this->heights[k + 1]) {
+                k++;
+            }
+        }
+        for (int i = k + 1; i < 5; i++) {
+            this->positions[i]++;
+        }
+        const std::array<float, 5> step{0.0f, p / 2.0f, p, (1.0f + p) / 2.0f, 1.0f};
+        for (int i = 0; i < 5; i++) {
+            this->desired[i] += step[i];
+        }
+
+        for (int i = 1; i < 4; i++) {
+            const float d = this->desired[i] - this->positions[i];
+            if ((d >= 1.0f && this->positions[i + 1] - this->positions[i] > 1) ||
+                (d <= -1.0f && this->positions[i - 1] - this->positions[i] < -1)) {
+                const int s = d >= 0.0f ? 1 : -1;
+                const float h = this->parabolic_(i, s);
+                if (this->heights[i - 1] < h && h < this->heights[i + 1]) {
+                    this->heights[i] = h;
+                } else {
+                    this->heights[i] += s * (this->heights[i + s] - this->heights[i]) /
+                                        (this->positions[i + s] - this->positions[i]);
+                }
+                this->positions[i] += s;
+            }
+        }
+        this->count++;
+    }
+
+    // NAN until the first sample; exact over the first five.
+    float value(float p) const {
+        if (this->count == 0) {
+            return NAN;
+        }
+        if (this->count >= 5) {
+            return this->heights[2];
+        }
+        auto sorted = this->heights;
+        std::sort(sorted.begin(), sorted.begin() + this->count);
+        const auto index = std::min<uint32_t>(static_cast<uint32_t>(p * this->count), this->count - 1);
+        return sorted[index];
+    }
+
+protected:
+    float parabolic_(int i, int s) const {
+        const float n0 = this->positions[i - 1];
+        const float n1 = this->positions[i];
+        const float n2 = this->positions[i + 1];
+        const float q0 = this->heights[i - 1];
+        const float q1 = this->heights[i];
+        const float q2 = this->heights[i + 1];
+        return q1 + s / (n2 - n0) * ((n1 - n0 + s) * (q2 - q1) / (n2 - n1) + (n2 - n1 - s) * (q1 - q0) / (n1 - n0));
+    }
+};
+
+// Travel times in one direction: a fast average following recent runs, a slow one as the long-term
+// baseline the fast one is compared against, and a running 90th percentile.
+struct TravelStats {
+    static constexpr float FAST_ALPHA = 0.2f;
+    static constexpr float SLOW_ALPHA = 0.02f;
+    static constexpr float QUANTILE = 0.9f;
+    // Recent travel this much slower than the baseline, once both have settled, is reported as drift.
+    static constexpr float    DRIFT_RATIO = 1.15f;
+    static constexpr uint32_t DRIFT_MIN_SAMPLES = 20;
+
+    float      fast_ms{0};
+    float      slow_ms{0};
+    uint32_t   samples{0};
+    P2Quantile p90{};
+
+    void add(float ms) {
+        if (this->samples == 0) {
+            this->fast_ms = ms;
+            this->slow_ms = ms;
+        } else {
+            this->fast_ms += FAST_ALPHA * (ms - this->fast_ms);
+            this->slow_ms += SLOW_ALPHA * (ms - this->slow_ms);
+        }
+        this->p90.add(ms, QUANTILE);
+        this->samples++;
+    }
+
+    float average_ms() const { return this->samples > 0 ? this->fast_ms : NAN; }
+    float p90_ms() const { return this->p90.value(QUANTILE); }
+    bool drifting() const { return this->samples >= DRIFT_MIN_SAMPLES && this->fast_ms > this->slow_ms * DRIFT_RATIO; }
+};
+
+// Long-running door usage and travel statistics, updated one event at a time in a fixed amount of memory
+// and saved to flash so they survive reboots and firmware updates.
+struct DoorHealth {
+    enum Direction : uint8_t { OPENING = 0, CLOSING = 1 };
+    static constexpr float DAY_ALPHA = 0.1f;
+    static constexpr uint32_t DAY_SECONDS = 24 * 60 * 60;
+    // Longer gaps, such as a device left unpowered, restart the day instead of folding in empty days.
+    static constexpr uint32_t MAX_ROLLED_DAYS = 7;
+    static constexpr uint32_t VERSION = 2;
+
+    uint32_t                   version{VERSION};
+    std::array<TravelStats, 2> travel{};
+    uint32_t                   cycles{0};
+    uint32_t                   obstructions{0};
+    uint32_t                   day_cycles{0};
+    uint32_t                   days{0};
+    float                      cycles_per_day{0};
+    uint32_t                   day_start{0}; // Unix time the current day began, 0 before the clock was set
+    uint16_t                   last_openings{0};
+    bool                       has_openings{false};
+
+    // Takes the opener's openings counter and returns true when it advanced. Its first value, and a counter
+    // that went backwards after an opener reset, only set the baseline.
+    bool record_openings(uint16_t openings) {
+        const bool advanced = this->has_openings && openings > this->last_openings;
+        if (advanced) {
+            const uint32_t delta = openings - this->last_openings;
+            this->cycles += delta;
+            this->day_cycles += delta;
+        }
+        this->last_openings = openings;
+        this->has_openings = true;
+        return advanced;
+    }
+
+    void record_obstruction() { this->obstructions++; }
+
+    // Folds the finished day into the daily average.
+    void close_day() {
+        if (this->days == 0) {
+            this->cycles_per_day = this->day_cycles;
+        } else {
+            this->cycles_per_day += DAY_ALPHA * (this->day_cycles - this->cycles_per_day);
+        }
+        this->days++;
+        this->day_cycles = 0;
+    }
+
+    // Closes each full day since day_start at the Unix time now, 0 while the clock is not set. Returns true
+    // when a day was closed. The first call with the clock set starts the day, as does a clock that went back.
+    bool roll_days(uint32_t now) {
+        if (now == 0) {
+            return false;
+        }
+        if (this->day_start == 0 || now < this->day_start) {
+            this->day_start = now;
+            return false;
+        }
+        const uint32_t elapsed = (now - this->day_start) / DAY_SECONDS;
+        for (uint32_t i = 0; i < std::min(elapsed, MAX_ROLLED_DAYS); i++) {
+            this->close_day();
+        }
+        this->day_start = elapsed > MAX_ROLLED_DAYS ? now : this->day_start + elapsed * DAY_SECONDS;
+        return elapsed > 0;
+    }
+
+    float daily_cycles() const { return this->days > 0 ? this->cycles_per_day : NAN; }
+    float obstructions_per_100_cycles() const {
+        return this->cycles > 0 ? 100.0f * this->obstructions / this->cycles : NAN;
+    }
+    bool drifting() const { return this->travel[OPENING].drifting() || this->travel[CLOSING].drifting(); }
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
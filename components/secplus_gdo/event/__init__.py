@@ -0,0 +1,72 @@
+"""
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ """
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import event
+from esphome.const import CONF_ID
+
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
+
+DEPENDENCIES = ["secplus_gdo"]
+
+GDOEvent = secplus_gdo_ns.class_("GDOEvent", event.Event, cg.Component)
+
+CONF_TYPE = "type"
+TYPES = {
+    "button": 0,
+    "wireless_remote": 1,
+    "motion": 2,
+    "obstruction": 3,
+}
+
+# The event_type values each entity type fires.
+EVENT_TYPES = {
+    "button": ["press"],
+    "wireless_remote": ["activation"],
+    "motion": ["motion"],
+    "obstruction": ["obstructed", "cleared"],
+}
+
+CONFIG_SCHEMA = cv.All(
+    event.event_schema(GDOEvent)
+    .extend(
+        {
+            cv.Required(CONF_TYPE): cv.enum(TYPES, lower=True),
+        }
+    )
+    .extend(SECPLUS_GDO_CONFIG_SCHEMA),
+    validate_cpp_symbol_id,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await event.register_event(var, config, event_types=EVENT_TYPES[config[CONF_TYPE]])
+    await cg.register_component(var, config)
+    parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("event", config[CONF_TYPE])
+    cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
+    cg.add(parent.register_event(var))
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cinttypes>
+#include <cstdint>
+
+#include "esphome/components/event/event.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+enum class GDOEventType : uint8_t {
+    BUTTON = 0,
+    WIRELESS_REMOTE,
+    MOTION,
+    OBSTRUCTION,
+};
+
+// One event per occurrence, instead of an on/off pair of binary sensor states.
+class GDOEvent : public event::Event, public Component {
+public:
+    void dump_config() override { ESP_LOGCONFIG(TAG, "GDO event type: %s", this->type_to_string_()); }
+    void set_type(uint8_t type) { this->type_ = static_cast<GDOEventType>(type); }
+    GDOEventType get_type() const { return this->type_; }
+
+    // at_us is the micros() time the occurrence was reported, which may be earlier than now.
+    void fire(const char *event_type, uint32_t at_us) {
+        this->last_us_ = at_us;
+        this->count_++;
+        ESP_LOGD(TAG, "%s: %s, %" PRIu32 " us after report", this->type_to_string_(), event_type, micros() - at_us);
+        this->trigger(event_type);
+    }
+
+    // micros() time of the last occurrence, for lambdas.
+    uint32_t last_us() const { return this->last_us_; }
+    // Occurrences since boot.
+    uint32_t count() const { return this->count_; }
+
+protected:
+    const char *type_to_string_() const {
+        switch (this->type_) {
+        case GDOEventType::BUTTON:
+            return "button";
+        case GDOEventType::WIRELESS_REMOTE:
+            return "wireless_remote";
+        case GDOEventType::MOTION:
+            return "motion";
+        case GDOEventType::OBSTRUCTION:
+            return "obstruction";
+        default:
+            return "unknown";
+        }
+    }
+
+    GDOEventType type_{GDOEventType::BUTTON};
+    uint32_t     last_us_{0};
+    uint32_t     count_{0};
+    static constexpr const char *TAG = "gdo.event";
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
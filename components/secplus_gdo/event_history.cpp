@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "event_history.h"
+
+#ifdef USE_SECPLUS_GDO_HISTORY
+
+#include <algorithm>
+
+#include "esp_err.h"
+#include "esphome/core/log.h"
+#include "inttypes.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+    static constexpr char TAG[] = "secplus_gdo.history";
+
+    // Reads a sector range one flash page at a time, then optionally the records still held in RAM.
+    class FlashSource {
+    public:
+        FlashSource(const esp_partition_t *partition, uint32_t sector_base, uint32_t start, uint32_t end)
+            : partition_(partition), sector_base_(sector_base), pos_(start), end_(end) {}
+
+        void set_tail(const uint8_t *tail, uint32_t len) {
+            this->tail_ = tail;
+            this->tail_len_ = len;
+        }
+
+        bool next(uint8_t *byte) {
+            if (this->pos_ >= this->end_) {
+                const uint32_t tail_pos = this->pos_ - this->end_;
+                if (tail_pos >= this->tail_len_) {
+                    return false;
+                }
+                *byte = this->tail_[tail_pos];
+                this->pos_++;
+                return true;
+            }
+            if (this->pos_ < this->buf_start_ || this->pos_ >= this->buf_start_ + this->buf_len_) {
+                this->buf_start_ = this->pos_;
+                this->buf_len_ = std::min<uint32_t>(this->buf_.size(), this->end_ - this->pos_);
+                if (esp_partition_read(this->partition_, this->sector_base_ + this->buf_start_, this->buf_.data(),
+                                       this->buf_len_) != ESP_OK) {
+                    this->buf_len_ = 0;
+                    return false;
+                }
+            }
+            *byte = this->buf_[this->pos_ - this->buf_start_];
+            this->pos_++;
+            return true;
+        }
+
+        uint32_t offset() const { return this->pos_; }
+
+    protected:
+        const esp_partition_t *partition_;
+        std::array<uint8_t, EventHistory::CHUNK_SIZE> buf_{};
+        const uint8_t *tail_{nullptr};
+        uint32_t tail_len_{0};
+        uint32_t sector_base_;
+        uint32_t pos_;
+        uint32_t end_;
+        uint32_t buf_start_{0};
+        uint32_t buf_len_{0};
+    };
+
+    bool EventHistory::begin(const char *label, uint32_t now_ms, uint32_t unix_s) {
+        this->partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+        if (this->partition_ == nullptr) {
+            ESP_LOGE(TAG, "No data partition named '%s'", label);
+            return false;
+        }
+        this->sector_count_ = this->partition_->size / SECTOR_SIZE;
+        if (this->sector_count_ < 2) {
+            ESP_LOGE(TAG, "Partition '%s' needs at least two sectors", label);
+            this->partition_ = nullptr;
+            return false;
+        }
+
+        bool found = false;
+        for (uint16_t sector = 0; sector < this->sector_count_; sector++) {
+            SectorHeader header;
+            if (!this->read_header_(sector, &header)) {
+                continue;
+            }
+            if (!found || static_cast<int32_t>(header.seq - this->head_seq_) > 0) {
+                found = true;
+                this->head_sector_ = sector;
+                this->head_seq_ = header.seq;
+            }
+        }
+
+        if (!found) {
+            this->start_sector_(0, 1);
+        } else {
+            FlashSource source(this->partition_, this->head_sector_ * SECTOR_SIZE, sizeof(SectorHeader), SECTOR_SIZE);
+            HistoryDecoder<FlashSource> decoder(source);
+            HistoryEntry entry;
+            while (decoder.next(&entry)) {
+            }
+            this->head_used_ = decoder.end();
+
+            // Appending is only safe on erased flash; a torn record left behind moves on to a fresh sector.
+            uint8_t next = HISTORY_END;
+            if (this->head_used_ < SECTOR_SIZE) {
+                esp_partition_read(this->partition_, this->head_sector_ * SECTOR_SIZE + this->head_used_, &next, 1);
+            }
+            if (next != HISTORY_END || this->head_used_ + 2 * HISTORY_RECORD_MAX_SIZE > SECTOR_SIZE) {
+                this->start_sector_((this->head_sector_ + 1) % this->sector_count_, this->head_seq_ + 1);
+            }
+        }
+
+        ESP_LOGD(TAG, "History in '%s': %" PRIu16 " sectors, writing sector %" PRIu16 " at %" PRIu32, label,
+                 this->sector_count_, this->head_sector_, this->head_used_);
+        this->write_time_base_(now_ms, unix_s);
+        return true;
+    }
+
+    void EventHistory::record_change(HistoryKind kind, uint32_t value, uint32_t now_ms, uint32_t unix_s) {
+        const auto index = static_cast<uint8_t>(kind);
+        if (this->partition_ == nullptr || index >= this->last_value_.size()) {
+            return;
+        }
+        if ((this->known_ & (1 << index)) && this->last_value_[index] == value) {
+            return;
+        }
+        this->known_ |= 1 << index;
+        this->last_value_[index] = value;
+
+        // Every sector opens with a time base so it decodes on its own once older sectors are erased.
+        if (this->head_used_ + this->pending_len_ + 2 * HISTORY_RECORD_MAX_SIZE > SECTOR_SIZE) {
+            this->flush();
+            // A failed write has already moved on to a fresh sector with its own time base.
+            if (this->head_used_ + 2 * HISTORY_RECORD_MAX_SIZE > SECTOR_SIZE) {
+                this->start_sector_((this->head_sector_ + 1) % this->sector_count_, this->head_seq_ + 1);
+                this->write_time_base_(now_ms, unix_s);
+            }
+        } else if ((unix_s != 0 && this->base_unix_s_ == 0) || now_ms - this->last_ms_ >= REANCHOR_MS) {
+            this->write_time_base_(now_ms, unix_s);
+        }
+        this->append_(kind, now_ms - this->last_ms_, value);
+        this->last_ms_ = now_ms;
+    }
+
+    void EventHistory::flush() {
+        if (this->partition_ == nullptr || this->pending_len_ == 0) {
+            return;
+        }
+        const auto err = esp_partition_write(this->partition_, this->head_sector_ * SECTOR_SIZE + this->head_used_,
+                                             this->pending_.data(), this->pending_len_);
+        if (err != ESP_OK) {
+            // The page may be partly programmed, so nothing can be appended after it. The records held in RAM
+            // are dropped and the history goes on in a fresh sector, anchored where they left off.
+            ESP_LOGW(TAG, "Failed to write %" PRIu32 " history bytes, dropping them: %s", this->pending_len_,
+                     esp_err_to_name(err));
+            this->pending_len_ = 0;
+            this->start_sector_((this->head_sector_ + 1) % this->sector_count_, this->head_seq_ + 1);
+            const uint32_t unix_s =
+                this->base_unix_s_ != 0 ? this->base_unix_s_ + (this->last_ms_ - this->base_ms_) / 1000 : 0;
+            this->write_time_base_(this->last_ms_, unix_s);
+            return;
+        }
+        this->head_used_ += this->pending_len_;
+        this->pending_len_ = 0;
+    }
+
+    size_t EventHistory::for_each(const HistoryQuery &query,
+                                  const std::function<bool(const HistoryEntry &)> &callback) {
+        HistoryCursor cursor;
+        size_t visited = 0;
+        this->walk(query, cursor, SIZE_MAX, [&](const HistoryEntry &entry) {
+            visited++;
+            return callback(entry);
+        });
+        return visited;
+    }
+
+    bool EventHistory::walk(const HistoryQuery &query, HistoryCursor &cursor, size_t max_records,
+                            const std::function<bool(const HistoryEntry &)> &callback) {
+        if (this->partition_ == nullptr) {
+            return false;
+        }
+        if (!cursor.started) {
+            cursor = HistoryCursor{};
+            cursor.sector = (this->head_sector_ + 1) % this->sector_count_;
+            cursor.started = true;
+        }
+
+        size_t decoded = 0;
+        while (decoded < max_records) {
+            const bool head = cursor.sector == this->head_sector_;
+            SectorHeader header;
+            const bool valid = this->read_header_(cursor.sector, &header);
+            if (valid && (cursor.offset == 0 || header.seq != cursor.seq)) {
+                // A new sector, or one erased and reused since the last call: its data starts over.
+                cursor.seq = header.seq;
+                cursor.offset = sizeof(SectorHeader);
+                cursor.base_s = 0;
+                cursor.elapsed_ms = 0;
+            }
+
+            if (valid) {
+                FlashSource source(this->partition_, cursor.sector * SECTOR_SIZE, cursor.offset,
+                                   head ? this->head_used_ : SECTOR_SIZE);
+                if (head) {
+                    source.set_tail(this->pending_.data(), this->pending_len_);
+                }
+                HistoryDecoder<FlashSource> decoder(source);
+                decoder.resume(cursor.base_s, cursor.elapsed_ms);
+                HistoryEntry entry;
+                while (true) {
+                    // Stopping after a whole record leaves the rest of the sector for the next call.
+                    const bool budget_spent = decoded >= max_records;
+                    if (budget_spent || !decoder.next(&entry)) {
+                        if (!budget_spent) {
+                            break;
+                        }
+                        cursor.offset = source.offset();
+                        cursor.base_s = decoder.base_s();
+                        cursor.elapsed_ms = decoder.elapsed_ms();
+                        return true;
+                    }
+                    decoded++;
+                    if (query.matches(entry) && !callback(entry)) {
+                        cursor.offset = source.offset();
+                        cursor.base_s = decoder.base_s();
+                        cursor.elapsed_ms = decoder.elapsed_ms();
+                        return true;
+                    }
+                }
+            }
+
+            if (head) {
+                cursor.started = false;
+                return false;
+            }
+            cursor.sector = (cursor.sector + 1) % this->sector_count_;
+            cursor.offset = 0;
+        }
+        return true;
+    }
+
+    void EventHistory::append_(HistoryKind kind, uint32_t delta_ms, uint32_t value) {
+        std::array<uint8_t, HISTORY_RECORD_MAX_SIZE> record;
+        const auto len = encode_history_record(kind, delta_ms, value, record.data());
+        if (this->pending_len_ + len > this->pending_.size()) {
+            this->flush();
+        }
+        std::copy(record.begin(), record.begin() + len, this->pending_.begin() + this->pending_len_);
+        this->pending_len_ += len;
+    }
+
+    void EventHistory::start_sector_(uint16_t sector, uint32_t seq) {
+        const uint32_t base = sector * SECTOR_SIZE;
+        auto err = esp_partition_erase_range(this->partition_, base, SECTOR_SIZE);
+        const SectorHeader header{SECTOR_MAGIC, seq};
+        if (err == ESP_OK) {
+            err = esp_partition_write(this->partition_, base, &header, sizeof(header));
+        }
+        if (err != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to start history sector %" PRIu16 ": %s", sector, esp_err_to_name(err));
+        }
+        this->head_sector_ = sector;
+        this->head_seq_ = seq;
+        this->head_used_ = sizeof(header);
+    }
+
+    void EventHistory::write_time_base_(uint32_t now_ms, uint32_t unix_s) {
+        this->append_(HistoryKind::TIME_BASE, 0, unix_s);
+        this->last_ms_ = now_ms;
+        this->base_ms_ = now_ms;
+        this->base_unix_s_ = unix_s;
+    }
+
+    bool EventHistory::read_header_(uint16_t sector, SectorHeader *header) const {
+        return esp_partition_read(this->partition_, sector * SECTOR_SIZE, header, sizeof(*header)) == ESP_OK &&
+               header->magic == SECTOR_MAGIC;
+    }
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_HISTORY
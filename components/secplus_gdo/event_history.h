@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_HISTORY
+#include "esp_partition.h"
+#endif
+
+namespace esphome {
+namespace secplus_gdo {
+
+// State changes kept in the on-device history. TIME_BASE anchors the relative timestamps that follow it.
+enum class HistoryKind : uint8_t {
+    TIME_BASE = 0,
+    DOOR,
+    LIGHT,
+    LOCK,
+    OBSTRUCTION,
+    MOTION,
+    MAX,
+};
+
+// One decoded record. unix_ms is 0 when the clock was not set when it was recorded.
+struct HistoryEntry {
+    HistoryKind kind;
+    uint32_t    value;
+    uint64_t    unix_ms;
+};
+
+// Records are a kind byte, the varint milliseconds since the previous record and a varint value, so most
+// take three bytes. A kind byte of 0xff is erased flash and ends the data.
+constexpr size_t HISTORY_RECORD_MAX_SIZE = 1 + 5 + 5;
+constexpr uint8_t HISTORY_END = 0xff;
+
+inline size_t encode_varint(uint32_t value, uint8_t *out) {
+    size_t len = 0;
+    while (value >= 0x80) {
+        out[len++] = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    out[len++] = static_cast<uint8_t>(value);
+    return len;
+}
+
+inline size_t encode_history_record(HistoryKind kind, uint32_t delta_ms, uint32_t value, uint8_t *out) {
+    out[0] = static_cast<uint8_t>(kind);
+    size_t len = 1;
+    len += encode_varint(delta_ms, out + len);
+    len += encode_varint(value, out + len);
+    return len;
+}
+
+// Decodes records from a byte stream. next(uint8_t *) returns false once the stream has no more bytes, and
+// offset() the stream position, so the end of the written data can be found.
+template<typename Source> class HistoryDecoder {
+public:
+    explicit HistoryDecoder(Source &source) : source_(source) {}
+
+    // Returns false at the end of the data or at a record that does not decode, such as a torn write.
+    bool next(HistoryEntry *entry) {
+        while (true) {
+            this->end_ = this->source_.offset();
+            uint8_t kind;
+            uint32_t delta_ms;
+            uint32_t value;
+            if (!this->source_.next(&kind) || kind >= static_cast<uint8_t>(HistoryKind::MAX) ||
+                !this->read_varint_(&delta_ms) || !this->read_varint_(&value)) {
+                return false;
+            }
+            if (kind == static_cast<uint8_t>(HistoryKind::TIME_BASE)) {
+                this->base_s_ = value;
+                this->elapsed_ms_ = 0;
+                continue;
+            }
+            this->elapsed_ms_ += delta_ms;
+            entry->kind = static_cast<HistoryKind>(kind);
+            entry->value = value;
+            entry->unix_ms = this->base_s_ != 0 ? uint64_t{this->base_s_} * 1000 + this->elapsed_ms_ : 0;
+            return true;
+        }
+    }
+
+    // Offset of the first byte after the last record that decoded.
+    uint32_t end() const { return this->end_; }
+
+    // Time base state, so a walk that stopped part way can carry on with a new decoder.
+    void resume(uint32_t base_s, uint64_t elapsed_ms) {
+        this->base_s_ = base_s;
+        this->elapsed_ms_ = elapsed_ms;
+    }
+    uint32_t base_s() const { return this->base_s_; }
+    uint64_t elapsed_ms() const { return this->elapsed_ms_; }
+
+protected:
+    bool read_varint_(uint32_t *value) {
+        *value = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            uint8_t byte;
+            if (!this->source_.next(&byte)) {
+                return false;
+            }
+            *value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Source  &source_;
+    uint32_t end_{0};
+    uint32_t base_s_{0};
+    uint64_t elapsed_ms_{0};
+};
+
+// Which records a history query visits. Records from before the clock was set only match an open start.
+struct HistoryQuery {
+    uint32_t since_s{0};
+    uint32_t until_s{UINT32_MAX};
+    uint8_t  kinds{0xff}; // bit per HistoryKind
+
+    bool matches(const HistoryEntry &entry) const {
+        if ((this->kinds & (1 << static_cast<uint8_t>(entry.kind))) == 0) {
+            return false;
+        }
+        if (entry.unix_ms == 0) {
+            return this->since_s == 0;
+        }
+        const uint64_t seconds = entry.unix_ms / 1000;
+        return seconds >= this->since_s && seconds <= this->until_s;
+    }
+};
+
+// Where a history walk that is spread over several calls stands. A fresh cursor starts at the oldest record.
+struct HistoryCursor {
+    uint16_t sector{0};
+    uint32_t seq{0};    // sequence number of sector, to notice it was erased and reused in between
+    uint32_t offset{0}; // next byte in sector, 0 before its header was read
+    uint32_t base_s{0};
+    uint64_t elapsed_ms{0};
+    bool     started{false};
+};
+
+#ifdef USE_SECPLUS_GDO_HISTORY
+// Append-only history of opener state changes in a dedicated data partition, used as a ring of flash
+// sectors: the oldest sector is erased only when the newest one is full, so every sector wears evenly.
+// Records collect in RAM and are written one flash program page at a time.
+class EventHistory {
+public:
+    static constexpr uint32_t SECTOR_SIZE = 4096;
+    static constexpr uint32_t CHUNK_SIZE = 256;
+    static constexpr uint32_t SECTOR_MAGIC = 0x48444753; // "SGDH"
+    // Past this gap the time base is written again, well before millis() wraps.
+    static constexpr uint32_t REANCHOR_MS = 24 * 60 * 60 * 1000;
+
+    // Finds the partition and the end of the newest data. Returns false when the partition is missing.
+    bool begin(const char *label, uint32_t now_ms, uint32_t unix_s);
+    // Records a value of kind unless it is the last value recorded for it.
+    void record_change(HistoryKind kind, uint32_t value, uint32_t now_ms, uint32_t unix_s);
+    // Writes records still held in RAM.
+    void flush();
+    // Streams matching records to callback, oldest first, until it returns false. Returns the number visited.
+    size_t for_each(const HistoryQuery &query, const std::function<bool(const HistoryEntry &)> &callback);
+    // Carries on a walk from cursor, decoding at most max_records records, matching or not, and stopping
+    // after one for which callback returns false. Returns true while records remain.
+    bool walk(const HistoryQuery &query, HistoryCursor &cursor, size_t max_records,
+              const std::function<bool(const HistoryEntry &)> &callback);
+
+    bool ready() const { return this->partition_ != nullptr; }
+    uint32_t capacity() const { return this->sector_count_ * SECTOR_SIZE; }
+
+protected:
+    struct SectorHeader {
+        uint32_t magic;
+        uint32_t seq;
+    };
+
+    void append_(HistoryKind kind, uint32_t delta_ms, uint32_t value);
+    void start_sector_(uint16_t sector, uint32_t seq);
+    void write_time_base_(uint32_t now_ms, uint32_t unix_s);
+    bool read_header_(uint16_t sector, SectorHeader *header) const;
+
+    const esp_partition_t          *partition_{nullptr};
+    std::array<uint8_t, CHUNK_SIZE> pending_{};
+    std::array<uint32_t, static_cast<size_t>(HistoryKind::MAX)> last_value_{};
+    uint32_t                        pending_len_{0};
+    uint32_t                        head_used_{0}; // bytes of the head sector already in flash
+    uint32_t                        head_seq_{0};
+    uint32_t                        last_ms_{0};
+    uint32_t                        base_ms_{0};     // millis() of the last time base
+    uint32_t                        base_unix_s_{0}; // its Unix time, 0 when the clock was not set
+    uint16_t                        sector_count_{0};
+    uint16_t                        head_sector_{0};
+    uint8_t                         known_{0}; // bit per HistoryKind with a value in last_value_
+};
+#endif
+
+} // namespace secplus_gdo
+} // namespace esphome
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/defines.h"
+#include "gdo.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// A gdolib status snapshot as handed to the main loop, stamped by the gdolib task when it was queued.
+struct QueuedStatus : gdo_status_t {
+    uint32_t queued_us{0};
+    uint32_t seq{0};
+};
+
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+constexpr size_t PRIORITY_EVENT_QUEUE_SIZE = 8;
+
+// Safety-relevant events that are handled ahead of anything already waiting in the main loop's defer queue.
+inline bool is_priority_event(const gdo_status_t &status, gdo_cb_event_t event) {
+    return event == GDO_CB_EVENT_OBSTRUCTION ||
+           (event == GDO_CB_EVENT_DOOR_POSITION && status.door == GDO_DOOR_STATE_STOPPED);
+}
+
+// Single-producer (gdolib task), single-consumer (main loop) ring for priority events.
+template<size_t N> class PriorityEventQueue {
+public:
+    struct Entry {
+        QueuedStatus   status;
+        gdo_cb_event_t event;
+    };
+
+    bool push(const QueuedStatus &status, gdo_cb_event_t event) {
+        const auto head = this->head_.load(std::memory_order_relaxed);
+        const auto next = static_cast<uint8_t>((head + 1) % N);
+        if (next == this->tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        this->entries_[head] = {status, event};
+        this->head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(Entry *entry) {
+        const auto tail = this->tail_.load(std::memory_order_relaxed);
+        if (tail == this->head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        *entry = this->entries_[tail];
+        this->tail_.store(static_cast<uint8_t>((tail + 1) % N), std::memory_order_release);
+        return true;
+    }
+
+protected:
+    static_assert(N > 1 && N <= 255, "priority queue size must fit the uint8_t indices");
+
+    std::array<Entry, N> entries_{};
+    std::atomic<uint8_t> head_{0};
+    std::atomic<uint8_t> tail_{0};
+};
+#endif
+
+} // namespace secplus_gdo
+} // namespace esphome
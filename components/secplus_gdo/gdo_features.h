@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+// The platform codegen emits one USE_SECPLUS_GDO_<PLATFORM> define per configured platform and one
+// USE_SECPLUS_GDO_<PLATFORM>_<TYPE> define per configured entity type. This header derives a 0/1
+// consumer flag per gdolib event from them so unused handlers and entity members compile out.
+
+#include "esphome/core/defines.h"
+
+// Door health statistics are built from openings, travel time measurements and obstructions.
+#if defined(USE_SECPLUS_GDO_SENSOR_OPEN_TIME_AVERAGE) || defined(USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_AVERAGE) || \
+    defined(USE_SECPLUS_GDO_SENSOR_OPEN_TIME_P90) || defined(USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_P90) || \
+    defined(USE_SECPLUS_GDO_SENSOR_CYCLES_PER_DAY) || defined(USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_RATE) || \
+    defined(USE_SECPLUS_GDO_BINARY_SENSOR_TRAVEL_DRIFT)
+#define SECPLUS_GDO_TRACKS_DOOR_HEALTH 1
+#else
+#define SECPLUS_GDO_TRACKS_DOOR_HEALTH 0
+#endif
+
+#if defined(USE_SECPLUS_GDO_BINARY_SENSOR_MOTOR) || defined(USE_SECPLUS_GDO_BINARY_SENSOR_WIRELESS_REMOTE) || \
+    defined(USE_SECPLUS_GDO_TEXT_SENSOR_LAST_TRIGGER_SOURCE) || defined(USE_SECPLUS_GDO_SENSOR_TRIGGER_LATENCY) || \
+    defined(USE_SECPLUS_GDO_EVENT_WIRELESS_REMOTE)
+#define SECPLUS_GDO_TRACKS_MOTOR 1
+#else
+#define SECPLUS_GDO_TRACKS_MOTOR 0
+#endif
+
+// Door position events also drive the motor-off edge used by trigger attribution.
+#if defined(USE_SECPLUS_GDO_COVER) || SECPLUS_GDO_TRACKS_MOTOR
+#define SECPLUS_GDO_TRACKS_DOOR 1
+#else
+#define SECPLUS_GDO_TRACKS_DOOR 0
+#endif
+
+// Wall button presses cancel a pending pre-close warning and are a trigger attribution cause.
+#if defined(USE_SECPLUS_GDO_BINARY_SENSOR_BUTTON) || defined(USE_SECPLUS_GDO_COVER) || SECPLUS_GDO_TRACKS_MOTOR || \
+    defined(USE_SECPLUS_GDO_EVENT_BUTTON)
+#define SECPLUS_GDO_TRACKS_BUTTON 1
+#else
+#define SECPLUS_GDO_TRACKS_BUTTON 0
+#endif
+
+#if defined(USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_TOTAL) || defined(USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_REMOTES) || \
+    defined(USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_KEYPADS) || \
+    defined(USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_WALL_CONTROLS) || \
+    defined(USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_ACCESSORIES)
+#define SECPLUS_GDO_TRACKS_PAIRED_DEVICES 1
+#else
+#define SECPLUS_GDO_TRACKS_PAIRED_DEVICES 0
+#endif
+
+#ifdef USE_SECPLUS_GDO_LIGHT
+#define SECPLUS_GDO_TRACKS_LIGHT 1
+#else
+#define SECPLUS_GDO_TRACKS_LIGHT 0
+#endif
+
+#ifdef USE_SECPLUS_GDO_LOCK
+#define SECPLUS_GDO_TRACKS_LOCK 1
+#else
+#define SECPLUS_GDO_TRACKS_LOCK 0
+#endif
+
+#ifdef USE_SECPLUS_GDO_SWITCH_LEARN
+#define SECPLUS_GDO_TRACKS_LEARN 1
+#else
+#define SECPLUS_GDO_TRACKS_LEARN 0
+#endif
+
+// Obstructions also cancel a pending pre-close warning and are compared against the obstruction pin.
+#if defined(USE_SECPLUS_GDO_BINARY_SENSOR_OBSTRUCTION) || defined(USE_SECPLUS_GDO_COVER) || \
+    defined(USE_SECPLUS_GDO_OBSTRUCTION_PIN) || defined(USE_SECPLUS_GDO_EVENT_OBSTRUCTION) || \
+    SECPLUS_GDO_TRACKS_DOOR_HEALTH
+#define SECPLUS_GDO_TRACKS_OBSTRUCTION 1
+#else
+#define SECPLUS_GDO_TRACKS_OBSTRUCTION 0
+#endif
+
+// Motion also restarts the auto-close countdown.
+#if defined(USE_SECPLUS_GDO_BINARY_SENSOR_MOTION) || defined(USE_SECPLUS_GDO_EVENT_MOTION) || \
+    defined(USE_SECPLUS_GDO_AUTO_CLOSE)
+#define SECPLUS_GDO_TRACKS_MOTION 1
+#else
+#define SECPLUS_GDO_TRACKS_MOTION 0
+#endif
+
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_BATTERY
+#define SECPLUS_GDO_TRACKS_BATTERY 1
+#else
+#define SECPLUS_GDO_TRACKS_BATTERY 0
+#endif
+
+#if defined(USE_SECPLUS_GDO_SENSOR_OPENINGS) || SECPLUS_GDO_TRACKS_DOOR_HEALTH
+#define SECPLUS_GDO_TRACKS_OPENINGS 1
+#else
+#define SECPLUS_GDO_TRACKS_OPENINGS 0
+#endif
+
+#if defined(USE_SECPLUS_GDO_NUMBER_OPEN_DURATION) || SECPLUS_GDO_TRACKS_DOOR_HEALTH
+#define SECPLUS_GDO_TRACKS_OPEN_DURATION 1
+#else
+#define SECPLUS_GDO_TRACKS_OPEN_DURATION 0
+#endif
+
+#if defined(USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION) || SECPLUS_GDO_TRACKS_DOOR_HEALTH
+#define SECPLUS_GDO_TRACKS_CLOSE_DURATION 1
+#else
+#define SECPLUS_GDO_TRACKS_CLOSE_DURATION 0
+#endif
+
+// The on-device history records door, light, lock, obstruction and motion changes whether or not an entity
+// for them is configured.
+#ifdef USE_SECPLUS_GDO_HISTORY
+#define SECPLUS_GDO_TRACKS_HISTORY 1
+#else
+#define SECPLUS_GDO_TRACKS_HISTORY 0
+#endif
+
+// The status snapshot covers every event.
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_STATUS_SNAPSHOT
+#define SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT 1
+#else
+#define SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT 0
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gdo_log.h"
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+#include "inttypes.h"
+
+#ifdef USE_LOGGER
+#include "esphome/components/logger/logger.h"
+#endif
+#ifdef USE_API
+#include "esphome/components/api/api_connection.h"
+#include "esphome/components/api/api_server.h"
+#endif
+#endif
+
+namespace esphome {
+namespace secplus_gdo {
+
+    GDOLog global_gdo_log; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+    bool GDOLog::is_logged_(const Record &record) const {
+#ifdef USE_LOGGER
+        // The logger's level for the tag, including runtime changes, decides whether the line is emitted at all.
+        if (logger::global_logger != nullptr) {
+            const auto *tag = log_subsystem_tag(static_cast<LogSubsystem>(record.subsystem));
+            if (record.level > logger::global_logger->level_for(tag)) {
+                return false;
+            }
+            // baud_rate: 0 turns the UART off; the line is then only seen by subscribed API clients.
+            if (logger::global_logger->get_baud_rate() > 0) {
+                return true;
+            }
+        }
+#endif
+#ifdef USE_API
+        if (api::global_api_server != nullptr) {
+            for (const auto &client : api::global_api_server->get_clients()) {
+                if (record.level <= client->get_log_subscription_level()) {
+                    return true;
+                }
+            }
+        }
+#endif
+        return false;
+    }
+
+    size_t GDOLog::drain(size_t max_records) {
+        if (this->count_ == 0) {
+            return 0;
+        }
+
+        if (this->dropped_ > 0) {
+            ESP_LOGW(log_subsystem_tag(LogSubsystem::COMPONENT), "Deferred log ring overflowed, %" PRIu32
+                     " records dropped", this->dropped_);
+            this->dropped_ = 0;
+        }
+
+        while (this->count_ > 0 && max_records-- > 0) {
+            const size_t tail = (this->head_ + this->ring_.size() - this->count_) % this->ring_.size();
+            const auto &record = this->ring_[tail];
+            --this->count_;
+            if (!this->is_logged_(record)) {
+                continue;
+            }
+            record.emit(record, log_subsystem_tag(static_cast<LogSubsystem>(record.subsystem)));
+        }
+        return this->count_;
+    }
+#endif
+
+} // namespace secplus_gdo
+} // namespace esphome
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+#include <cinttypes>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#endif
+
+namespace esphome {
+namespace secplus_gdo {
+
+enum class LogSubsystem : uint8_t {
+    COMPONENT = 0,
+    DOOR,
+    LIGHT,
+    LOCK,
+    COUNT,
+};
+
+inline const char *log_subsystem_tag(LogSubsystem subsystem) {
+    switch (subsystem) {
+    case LogSubsystem::DOOR:
+        return "gdo_cover";
+    case LogSubsystem::LIGHT:
+        return "GDOLight";
+    case LogSubsystem::LOCK:
+        return "GDOLock";
+    case LogSubsystem::COMPONENT:
+    default:
+        return "secplus_gdo";
+    }
+}
+
+// Hot-path log sink with a runtime verbosity per subsystem. In deferred mode a log call only copies
+// the format pointer and raw arguments into a ring; the main loop later hands them to the logger,
+// which formats each line once, and only for records that the logger's level for the subsystem tag
+// lets through while a UART or a log-subscribed API client would receive them.
+class GDOLog {
+public:
+    GDOLog() { this->levels_.fill(ESPHOME_LOG_LEVEL_VERY_VERBOSE); }
+
+    void set_level(LogSubsystem subsystem, uint8_t level) { this->levels_[static_cast<uint8_t>(subsystem)] = level; }
+    uint8_t get_level(LogSubsystem subsystem) const { return this->levels_[static_cast<uint8_t>(subsystem)]; }
+    bool is_enabled(LogSubsystem subsystem, uint8_t level) const {
+        return level <= this->levels_[static_cast<uint8_t>(subsystem)];
+    }
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+    static constexpr size_t ARG_BYTES = 16;
+
+    // Arguments must be scalars or pointers to strings with static storage, such as the
+    // gdo_*_to_string() tables; they are formatted after the caller has returned. The format takes
+    // the capture time in ms as its first argument, ahead of args.
+    template<typename... Args> void record(LogSubsystem subsystem, uint8_t level, const char *format, Args... args) {
+        static_assert((0 + ... + sizeof(Args)) <= ARG_BYTES, "too many deferred log arguments");
+        static_assert((... && (std::is_arithmetic_v<Args> || std::is_enum_v<Args> ||
+                               std::is_same_v<Args, const char *>)),
+                      "deferred log arguments must be scalars or static strings");
+
+        auto &record = this->ring_[this->head_];
+        record.format = format;
+        record.emit = &GDOLog::emit_record_<Args...>;
+        record.timestamp = millis();
+        record.subsystem = static_cast<uint8_t>(subsystem);
+        record.level = level;
+        uint8_t *out = record.args;
+        ((std::memcpy(out, &args, sizeof(Args)), out += sizeof(Args)), ...);
+
+        this->head_ = (this->head_ + 1) % this->ring_.size();
+        if (this->count_ < this->ring_.size()) {
+            ++this->count_;
+        } else {
+            ++this->dropped_;
+        }
+    }
+
+    // Emits at most max_records pending records. Returns the number still pending.
+    size_t drain(size_t max_records);
+    size_t pending() const { return this->count_; }
+#endif
+
+protected:
+    std::array<uint8_t, static_cast<uint8_t>(LogSubsystem::COUNT)> levels_{};
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+    struct Record {
+        const char *format;
+        void (*emit)(const Record &record, const char *tag);
+        uint32_t timestamp;
+        uint8_t  subsystem;
+        uint8_t  level;
+        uint8_t  args[ARG_BYTES];
+    };
+
+    // Whether the logger would emit the record and something would receive it; other records are
+    // dropped without formatting.
+    bool is_logged_(const Record &record) const;
+
+    template<typename T> static T read_arg_(const uint8_t *&in) {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+
+    template<typename... Args> static void emit_record_(const Record &record, const char *tag) {
+        [[maybe_unused]] const uint8_t *in = record.args;
+        // Braced initialization evaluates left to right, matching the order the arguments were stored in.
+        std::tuple<Args...> args{read_arg_<Args>(in)...};
+        std::apply(
+            [&](auto... values) {
+                esp_log_printf_(record.level, tag, __LINE__, record.format, record.timestamp, values...);
+            },
+            args);
+    }
+
+    std::array<Record, SECPLUS_GDO_LOG_BUFFER_SIZE> ring_{};
+    size_t   head_{0};
+    size_t   count_{0};
+    uint32_t dropped_{0};
+#endif
+};
+
+extern GDOLog global_gdo_log; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+#define GDO_LOG_AT_(subsystem, level, format, ...) \
+    do { \
+        if (::esphome::secplus_gdo::global_gdo_log.is_enabled(subsystem, level)) { \
+            ::esphome::secplus_gdo::global_gdo_log.record(subsystem, level, "[@%" PRIu32 "ms] " format, \
+                                                          ##__VA_ARGS__); \
+        } \
+    } while (0)
+#else
+#define GDO_LOG_AT_(subsystem, level, format, ...) \
+    do { \
+        if (::esphome::secplus_gdo::global_gdo_log.is_enabled(subsystem, level)) { \
+            ::esphome::esp_log_printf_(level, ::esphome::secplus_gdo::log_subsystem_tag(subsystem), __LINE__, format, \
+                                       ##__VA_ARGS__); \
+        } \
+    } while (0)
+#endif
+
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO
+#define GDO_LOGI(subsystem, format, ...) GDO_LOG_AT_(subsystem, ESPHOME_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#else
+#define GDO_LOGI(subsystem, format, ...)
+#endif
+
+#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_DEBUG
+#define GDO_LOGD(subsystem, format, ...) GDO_LOG_AT_(subsystem, ESPHOME_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
+#else
+#define GDO_LOGD(subsystem, format, ...)
+#endif
@@ -22,7 +22,13 @@ import esphome.config_validation as cv
 from esphome.components import light
 from esphome.const import CONF_OUTPUT_ID  # New in 2023.5
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -42,4 +48,5 @@ async def to_code(config):
     await cg.register_component(var, config)
     await light.register_light(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("light")
     cg.add(parent.register_light(var))
@@ -18,10 +18,17 @@
 
 #pragma once
 
+#include <cinttypes>
+#include <functional>
+#include <utility>
+
 #include "esphome/components/light/light_output.h"
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "gdo.h"
+#include "../command_reconciler.h"
+#include "../gdo_log.h"
 
 namespace esphome {
 namespace secplus_gdo {
@@ -50,37 +57,92 @@ class GDOLight : public light::LightOutput, public Component {
 
             bool binary;
             state->current_values_as_binary(&binary);
-            const auto err = binary ? gdo_light_on() : gdo_light_off();
-            if (err != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to send light command: %s", esp_err_to_name(err));
-            }
+            this->command_.request(binary);
+            this->set_timeout("command", CommandReconciler::COALESCE_MS, [this]() { this->send_command_(); });
         }
 
         void set_state(gdo_light_state_t state) {
+            if (state == GDO_LIGHT_STATE_ON || state == GDO_LIGHT_STATE_OFF) {
+                uint32_t latency_ms;
+                if (this->command_.confirm(state == GDO_LIGHT_STATE_ON, millis(), &latency_ms)) {
+                    this->cancel_timeout("command");
+                    ESP_LOGD(TAG, "Light command confirmed after %" PRIu32 " ms", latency_ms);
+                    if (this->f_outcome_) {
+                        this->f_outcome_(true, latency_ms);
+                    }
+                }
+            }
+
             if (state == this->light_state_) {
                 return;
             }
 
             this->light_state_ = state;
-            ESP_LOGI(TAG, "Light state: %s", gdo_light_state_to_string(state));
+            GDO_LOGI(LogSubsystem::LIGHT, "Light state: %s", gdo_light_state_to_string(state));
+            this->publish_(state == GDO_LIGHT_STATE_ON);
+        }
+
+        void set_sync_state(bool synced) {
+            this->synced_ = synced;
+            if (!synced) {
+                this->cancel_timeout("command");
+                this->command_.cancel();
+            }
+        }
+        void set_command_callback(std::function<void()> f) { this->f_command_ = std::move(f); }
+        // Called with true and the latency when the opener confirms a command, or false when it never did.
+        void set_outcome_callback(std::function<void(bool, uint32_t)> f) { this->f_outcome_ = std::move(f); }
+
+    protected:
+        void send_command_() {
+            if (!this->command_.pending()) {
+                return;
+            }
+            if (this->command_.attempts() == 0 && this->command_.satisfied()) {
+                // Toggled back to the reported state within the coalescing window.
+                this->command_.cancel();
+                return;
+            }
+            if (!this->command_.begin_attempt(millis())) {
+                ESP_LOGW(TAG, "Light command not confirmed after %u attempts", CommandReconciler::MAX_ATTEMPTS);
+                if (this->command_.has_confirmed()) {
+                    // Show what the opener last reported rather than the unconfirmed request.
+                    this->publish_(this->command_.confirmed());
+                }
+                if (this->f_outcome_) {
+                    this->f_outcome_(false, 0);
+                }
+                return;
+            }
+
+            const auto err = this->command_.desired() ? gdo_light_on() : gdo_light_off();
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to send light command: %s", esp_err_to_name(err));
+            } else if (this->f_command_) {
+                this->f_command_();
+            }
+            this->set_timeout("command", this->command_.retry_delay_ms(), [this]() { this->send_command_(); });
+        }
+
+        void publish_(bool is_on) {
             if (this->state_ == nullptr) {
                 ESP_LOGW(TAG, "Skipping light publish because LightState is not ready yet");
                 return;
             }
 
-            const bool is_on = state == GDO_LIGHT_STATE_ON;
             this->state_->current_values.set_state(is_on);
             this->state_->remote_values.set_state(is_on);
             this->state_->publish_state();
         }
 
-        void set_sync_state(bool synced) { this->synced_ = synced; }
-
     private:
         light::LightState *state_{nullptr};
         gdo_light_state_t light_state_{GDO_LIGHT_STATE_MAX};
         static constexpr auto TAG{"GDOLight"};
         bool synced_{false};
+        std::function<void()> f_command_{nullptr};
+        std::function<void(bool, uint32_t)> f_outcome_{nullptr};
+        CommandReconciler command_;
     }; // GDOLight
 } // namespace secplus_gdo
 } // namespace esphome
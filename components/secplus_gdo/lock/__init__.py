@@ -21,7 +21,13 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import lock
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -36,4 +42,5 @@ async def to_code(config):
     var = await lock.new_lock(config)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("lock")
     cg.add(parent.register_lock(var))
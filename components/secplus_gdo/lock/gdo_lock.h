@@ -18,10 +18,17 @@
 
 #pragma once
 
+#include <cinttypes>
+#include <functional>
+#include <utility>
+
 #include "esphome/components/lock/lock.h"
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "gdo.h"
+#include "../command_reconciler.h"
+#include "../gdo_log.h"
 
 namespace esphome {
 namespace secplus_gdo {
@@ -31,15 +38,24 @@ namespace secplus_gdo {
         void dump_config() override { ESP_LOGCONFIG(TAG, "GDO lock configured"); }
 
         void set_state(gdo_lock_state_t state) {
+            if (state == GDO_LOCK_STATE_LOCKED || state == GDO_LOCK_STATE_UNLOCKED) {
+                uint32_t latency_ms;
+                if (this->command_.confirm(state == GDO_LOCK_STATE_LOCKED, millis(), &latency_ms)) {
+                    this->cancel_timeout("command");
+                    ESP_LOGD(TAG, "Lock command confirmed after %" PRIu32 " ms", latency_ms);
+                    if (this->f_outcome_) {
+                        this->f_outcome_(true, latency_ms);
+                    }
+                }
+            }
+
             if (state == this->lock_state_) {
                 return;
             }
 
             this->lock_state_ = state;
-            ESP_LOGI(TAG, "Lock state: %s", gdo_lock_state_to_string(state));
-            this->publish_state(state == GDO_LOCK_STATE_LOCKED ?
-                                         lock::LockState::LOCK_STATE_LOCKED :
-                                         lock::LockState::LOCK_STATE_UNLOCKED);
+            GDO_LOGI(LogSubsystem::LOCK, "Lock state: %s", gdo_lock_state_to_string(state));
+            this->publish_(state == GDO_LOCK_STATE_LOCKED);
         }
 
         void control(const lock::LockCall &call) override {
@@ -54,29 +70,68 @@ namespace secplus_gdo {
             }
 
             auto state = *call.get_state();
-            esp_err_t err = ESP_OK;
-
-            if (state == lock::LockState::LOCK_STATE_LOCKED) {
-                err = gdo_lock();
-            } else if (state == lock::LockState::LOCK_STATE_UNLOCKED) {
-                err = gdo_unlock();
-            } else {
+            if (state != lock::LockState::LOCK_STATE_LOCKED && state != lock::LockState::LOCK_STATE_UNLOCKED) {
                 ESP_LOGE(TAG, "Unsupported lock state requested");
                 return;
             }
 
+            this->command_.request(state == lock::LockState::LOCK_STATE_LOCKED);
+            this->set_timeout("command", CommandReconciler::COALESCE_MS, [this]() { this->send_command_(); });
+        }
+
+        void set_sync_state(bool synced) {
+            this->synced_ = synced;
+            if (!synced) {
+                this->cancel_timeout("command");
+                this->command_.cancel();
+            }
+        }
+
+        void set_command_callback(std::function<void()> f) { this->f_command_ = std::move(f); }
+        // Called with true and the latency when the opener confirms a command, or false when it never did.
+        void set_outcome_callback(std::function<void(bool, uint32_t)> f) { this->f_outcome_ = std::move(f); }
+
+    protected:
+        void send_command_() {
+            if (!this->command_.pending()) {
+                return;
+            }
+            if (this->command_.attempts() == 0 && this->command_.satisfied()) {
+                // Changed back to the reported state within the coalescing window.
+                this->command_.cancel();
+                return;
+            }
+            if (!this->command_.begin_attempt(millis())) {
+                ESP_LOGW(TAG, "Lock command not confirmed after %u attempts", CommandReconciler::MAX_ATTEMPTS);
+                if (this->command_.has_confirmed()) {
+                    // Clear any pending locking/unlocking state in the frontend.
+                    this->publish_(this->command_.confirmed());
+                }
+                if (this->f_outcome_) {
+                    this->f_outcome_(false, 0);
+                }
+                return;
+            }
+
+            const auto err = this->command_.desired() ? gdo_lock() : gdo_unlock();
             if (err != ESP_OK) {
                 ESP_LOGE(TAG, "Failed to send lock command: %s", esp_err_to_name(err));
+            } else if (this->f_command_) {
+                this->f_command_();
             }
+            this->set_timeout("command", this->command_.retry_delay_ms(), [this]() { this->send_command_(); });
         }
 
-        void set_sync_state(bool synced) {
-            this->synced_ = synced;
+        void publish_(bool locked) {
+            this->publish_state(locked ? lock::LockState::LOCK_STATE_LOCKED : lock::LockState::LOCK_STATE_UNLOCKED);
         }
 
     private:
         gdo_lock_state_t lock_state_{GDO_LOCK_STATE_MAX};
         bool synced_{false};
+        std::function<void()> f_command_{nullptr};
+        std::function<void(bool, uint32_t)> f_outcome_{nullptr};
+        CommandReconciler command_;
         static constexpr const char *TAG = "GDOLock";
     };
 
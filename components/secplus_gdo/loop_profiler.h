@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+
+#include <array>
+#include <cstdint>
+
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "esphome/core/log.h"
+#include "inttypes.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+enum class ProfileSlot : uint8_t {
+    EVENT_SYNCED = 0,
+    EVENT_LIGHT,
+    EVENT_LOCK,
+    EVENT_DOOR_POSITION,
+    EVENT_LEARN,
+    EVENT_OBSTRUCTION,
+    EVENT_MOTION,
+    EVENT_BATTERY,
+    EVENT_BUTTON,
+    EVENT_MOTOR,
+    EVENT_OPENINGS,
+    EVENT_TTC,
+    EVENT_PAIRED_DEVICES,
+    EVENT_OPEN_DURATION,
+    EVENT_CLOSE_DURATION,
+    EVENT_UNKNOWN,
+    GDO_SET_ROLLING_CODE,
+    GDO_SYNC,
+    GDO_DEINIT,
+    GDO_INIT,
+    DRIVER_RESTART,
+    COUNT,
+};
+
+inline const char *profile_slot_to_string(ProfileSlot slot) {
+    switch (slot) {
+    case ProfileSlot::EVENT_SYNCED:
+        return "event synced";
+    case ProfileSlot::EVENT_LIGHT:
+        return "event light";
+    case ProfileSlot::EVENT_LOCK:
+        return "event lock";
+    case ProfileSlot::EVENT_DOOR_POSITION:
+        return "event door position";
+    case ProfileSlot::EVENT_LEARN:
+        return "event learn";
+    case ProfileSlot::EVENT_OBSTRUCTION:
+        return "event obstruction";
+    case ProfileSlot::EVENT_MOTION:
+        return "event motion";
+    case ProfileSlot::EVENT_BATTERY:
+        return "event battery";
+    case ProfileSlot::EVENT_BUTTON:
+        return "event button";
+    case ProfileSlot::EVENT_MOTOR:
+        return "event motor";
+    case ProfileSlot::EVENT_OPENINGS:
+        return "event openings";
+    case ProfileSlot::EVENT_TTC:
+        return "event ttc";
+    case ProfileSlot::EVENT_PAIRED_DEVICES:
+        return "event paired devices";
+    case ProfileSlot::EVENT_OPEN_DURATION:
+        return "event open duration";
+    case ProfileSlot::EVENT_CLOSE_DURATION:
+        return "event close duration";
+    case ProfileSlot::EVENT_UNKNOWN:
+        return "event unknown";
+    case ProfileSlot::GDO_SET_ROLLING_CODE:
+        return "gdo_set_rolling_code";
+    case ProfileSlot::GDO_SYNC:
+        return "gdo_sync";
+    case ProfileSlot::GDO_DEINIT:
+        return "gdo_deinit";
+    case ProfileSlot::GDO_INIT:
+        return "gdo_init";
+    case ProfileSlot::DRIVER_RESTART:
+        return "driver restart";
+    default:
+        return "unknown";
+    }
+}
+
+// Accumulates CPU cycle counts per handler between reports. Only the main loop task records into it.
+class LoopProfiler {
+public:
+    void set_budget_us(uint32_t us) { this->budget_us_ = us; }
+    uint32_t get_budget_us() const { return this->budget_us_; }
+
+    void record(ProfileSlot slot, uint32_t cycles) {
+        auto &stat = this->stats_[static_cast<uint8_t>(slot)];
+        ++stat.count;
+        stat.total_cycles += cycles;
+        if (cycles > stat.max_cycles) {
+            stat.max_cycles = cycles;
+        }
+
+        const uint32_t us = cycles / esp_rom_get_cpu_ticks_per_us();
+        if (this->budget_us_ != 0 && us > this->budget_us_) {
+            ++stat.over_budget;
+            ESP_LOGW(TAG, "%s took %" PRIu32 " us (budget %" PRIu32 " us)", profile_slot_to_string(slot), us,
+                     this->budget_us_);
+        }
+    }
+
+    // Time from the gdolib callback to the main loop handler. Priority events are kept apart so the
+    // effect of the priority drain shows up in the report.
+    void record_dispatch(bool priority, uint32_t us) {
+        auto &stat = this->dispatch_[priority ? 1 : 0];
+        ++stat.count;
+        stat.total_us += us;
+        if (us > stat.max_us) {
+            stat.max_us = us;
+        }
+    }
+
+    // Logs every slot that ran since the previous report, then starts a new interval.
+    void report() {
+        for (uint8_t i = 0; i < this->dispatch_.size(); i++) {
+            auto &stat = this->dispatch_[i];
+            if (stat.count == 0) {
+                continue;
+            }
+            ESP_LOGD(TAG, "%s dispatch: count=%" PRIu32 " avg=%" PRIu32 " us max=%" PRIu32 " us",
+                     i == 0 ? "event" : "priority event", stat.count, static_cast<uint32_t>(stat.total_us / stat.count),
+                     stat.max_us);
+            stat = {};
+        }
+
+        const uint32_t ticks_per_us = esp_rom_get_cpu_ticks_per_us();
+        for (uint8_t i = 0; i < this->stats_.size(); i++) {
+            auto &stat = this->stats_[i];
+            if (stat.count == 0) {
+                continue;
+            }
+
+            const auto avg_us = static_cast<uint32_t>(stat.total_cycles / stat.count / ticks_per_us);
+            const auto max_us = stat.max_cycles / ticks_per_us;
+            if (stat.over_budget > 0) {
+                ESP_LOGW(TAG, "%s: count=%" PRIu32 " avg=%" PRIu32 " us max=%" PRIu32 " us over budget=%" PRIu32,
+                         profile_slot_to_string(static_cast<ProfileSlot>(i)), stat.count, avg_us, max_us,
+                         stat.over_budget);
+            } else {
+                ESP_LOGD(TAG, "%s: count=%" PRIu32 " avg=%" PRIu32 " us max=%" PRIu32 " us",
+                         profile_slot_to_string(static_cast<ProfileSlot>(i)), stat.count, avg_us, max_us);
+            }
+            stat = {};
+        }
+    }
+
+protected:
+    struct Stat {
+        uint64_t total_cycles{0};
+        uint32_t max_cycles{0};
+        uint32_t count{0};
+        uint32_t over_budget{0};
+    };
+
+    struct DispatchStat {
+        uint64_t total_us{0};
+        uint32_t max_us{0};
+        uint32_t count{0};
+    };
+
+    std::array<Stat, static_cast<uint8_t>(ProfileSlot::COUNT)> stats_{};
+    std::array<DispatchStat, 2> dispatch_{};
+    uint32_t budget_us_{0};
+    static constexpr const char *TAG = "secplus_gdo.profile";
+};
+
+class LoopProfileScope {
+public:
+    LoopProfileScope(LoopProfiler &profiler, ProfileSlot slot)
+        : profiler_(profiler), slot_(slot), start_(esp_cpu_get_cycle_count()) {}
+    ~LoopProfileScope() { this->profiler_.record(this->slot_, esp_cpu_get_cycle_count() - this->start_); }
+
+    LoopProfileScope(const LoopProfileScope &) = delete;
+    LoopProfileScope &operator=(const LoopProfileScope &) = delete;
+
+protected:
+    LoopProfiler &profiler_;
+    ProfileSlot   slot_;
+    uint32_t      start_;
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+// Times the rest of the enclosing block. Expands to nothing unless loop_profile is configured.
+#define GDO_PROFILE_SCOPE(profiler, slot) ::esphome::secplus_gdo::LoopProfileScope gdo_profile_scope_(profiler, slot)
+
+#else
+
+#define GDO_PROFILE_SCOPE(profiler, slot)
+
+#endif // USE_SECPLUS_GDO_LOOP_PROFILE
@@ -22,7 +22,14 @@ import esphome.config_validation as cv
 from esphome.components import number
 from esphome.const import CONF_ID
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    is_monitor_only,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -49,6 +56,9 @@ CONFIG_SCHEMA = cv.All(
 
 
 async def to_code(config):
+    if is_monitor_only(config[CONF_SECPLUS_GDO_ID]):
+        # Every number here configures gdolib, which monitor_only never starts.
+        return
     var = cg.new_Pvariable(config[CONF_ID])
     if config[CONF_TYPE] in ("open_duration", "close_duration"):
         await number.register_number(var, config, min_value=0x0, max_value=0xFFFF, step=1)
@@ -56,5 +66,6 @@ async def to_code(config):
         await number.register_number(var, config, min_value=0x0, max_value=0xFFFFFFFF, step=1)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("number", config[CONF_TYPE])
     cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
     cg.add(parent.register_number(var))
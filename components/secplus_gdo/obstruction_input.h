@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+
+#include <array>
+#include <cstdint>
+
+#include "esphome/core/gpio.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Decodes the safety sensor line. While the beam is clear the sensors pulse the line low every few
+// milliseconds; a blocked beam stops the pulses with the line held low, and a sleeping opener stops them
+// with the line held high. Edges are timestamped in the interrupt; the pattern is judged from the main loop.
+class ObstructionInput {
+public:
+    enum class Reading : uint8_t {
+        NONE = 0,
+        CLEAR,
+        OBSTRUCTED,
+    };
+
+    // Pulses needed before the beam counts as clear, so a single glitch cannot clear an obstruction.
+    static constexpr uint32_t CLEAR_PULSES = 3;
+    // Nominal gap between sensor pulses.
+    static constexpr uint32_t PULSE_PERIOD_US = 7000;
+    // About ten missed pulses with the line low mean the beam is blocked.
+    static constexpr uint32_t SILENCE_US = 70000;
+
+    void setup(InternalGPIOPin *pin) {
+        this->pin_ = pin;
+        pin->setup();
+        pin->attach_interrupt(&ObstructionInput::pulse_isr_, &this->capture_, gpio::INTERRUPT_FALLING_EDGE);
+    }
+
+    // Returns a reading when the decoded state changes. at_us is set to when the change began on the wire.
+    Reading poll(uint32_t now_us, uint32_t *at_us) {
+        uint32_t pulses;
+        uint32_t first_us;
+        uint32_t last_us;
+        {
+            InterruptLock lock;
+            pulses = this->capture_.pulses;
+            first_us = this->capture_.first_us;
+            last_us = this->capture_.last_us;
+            if (pulses >= CLEAR_PULSES) {
+                this->capture_.pulses = 0;
+            }
+        }
+
+        if (pulses >= CLEAR_PULSES) {
+            this->last_pulse_us_ = last_us;
+            if (this->state_ == Reading::CLEAR) {
+                return Reading::NONE;
+            }
+            this->state_ = Reading::CLEAR;
+            *at_us = first_us;
+            return Reading::CLEAR;
+        }
+
+        const uint32_t silent_since = pulses > 0 ? last_us : this->last_pulse_us_;
+        if (now_us - silent_since < SILENCE_US) {
+            return Reading::NONE;
+        }
+        if (pulses > 0) {
+            // Too few pulses to be the sensor pattern; treat them as noise.
+            InterruptLock lock;
+            this->capture_.pulses = 0;
+            this->last_pulse_us_ = last_us;
+        }
+
+        if (this->state_ == Reading::OBSTRUCTED || this->pin_->digital_read()) {
+            // Already reported, or the line is idling high while the opener sleeps.
+            return Reading::NONE;
+        }
+        this->state_ = Reading::OBSTRUCTED;
+        // Date the obstruction at the first pulse that failed to arrive.
+        *at_us = now_us - silent_since > SILENCE_US * 2 ? now_us - SILENCE_US : silent_since + PULSE_PERIOD_US;
+        return Reading::OBSTRUCTED;
+    }
+
+protected:
+    struct PulseCapture {
+        volatile uint32_t pulses{0};
+        volatile uint32_t first_us{0};
+        volatile uint32_t last_us{0};
+    };
+
+    static void IRAM_ATTR pulse_isr_(PulseCapture *capture) {
+        const uint32_t now = micros();
+        if (capture->pulses == 0) {
+            capture->first_us = now;
+        }
+        capture->last_us = now;
+        capture->pulses = capture->pulses + 1;
+    }
+
+    InternalGPIOPin *pin_{nullptr};
+    PulseCapture     capture_;
+    uint32_t         last_pulse_us_{0};
+    Reading          state_{Reading::NONE};
+};
+
+// Pairs the pin-derived and status-derived reports of the same obstruction change so the lead of the
+// pin over the opener's status message can be reported.
+class ObstructionPathCompare {
+public:
+    enum Path : uint8_t {
+        PIN = 0,
+        STATUS,
+    };
+
+    // Reports older than this are not paired; the other path missed that change.
+    static constexpr uint32_t PAIR_WINDOW_MS = 5000;
+
+    // Returns true once both paths have reported the same change. lead_ms is positive when the pin was first.
+    bool record(Path path, bool obstructed, uint32_t at_ms, int32_t *lead_ms) {
+        auto &other = this->reports_[path == PIN ? STATUS : PIN];
+        if (other.pending && other.obstructed == obstructed && at_ms - other.at_ms <= PAIR_WINDOW_MS) {
+            other.pending = false;
+            const auto gap = static_cast<int32_t>(at_ms - other.at_ms);
+            *lead_ms = path == STATUS ? gap : -gap;
+            return true;
+        }
+
+        this->reports_[path] = {at_ms, obstructed, true};
+        return false;
+    }
+
+protected:
+    struct Report {
+        uint32_t at_ms{0};
+        bool     obstructed{false};
+        bool     pending{false};
+    };
+
+    std::array<Report, 2> reports_{};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_OBSTRUCTION_PIN
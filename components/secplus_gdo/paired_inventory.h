@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "gdo_features.h"
+
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
+
+#include <array>
+#include <cstdint>
+
+#include "gdo.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Last known paired-device counts, indexed by gdo_paired_device_type_t, with the Unix time each one last
+// changed (0 when unknown or the clock was not set). Saved to flash so the counts can be published at boot.
+struct PairedInventory {
+    std::array<uint8_t, GDO_PAIRED_DEVICE_TYPE_MAX>  counts{};
+    std::array<uint32_t, GDO_PAIRED_DEVICE_TYPE_MAX> changed_at{};
+    bool                                             known{false};
+
+    static uint8_t count_of(const gdo_paired_device_t &report, gdo_paired_device_type_t type) {
+        switch (type) {
+        case GDO_PAIRED_DEVICE_TYPE_ALL:
+            return report.total_all;
+        case GDO_PAIRED_DEVICE_TYPE_REMOTE:
+            return report.total_remotes;
+        case GDO_PAIRED_DEVICE_TYPE_KEYPAD:
+            return report.total_keypads;
+        case GDO_PAIRED_DEVICE_TYPE_WALL_CONTROL:
+            return report.total_wall_controls;
+        case GDO_PAIRED_DEVICE_TYPE_ACCESSORY:
+            return report.total_accessories;
+        default:
+            return 0;
+        }
+    }
+
+    // Takes a report from the opener and returns a bit per gdo_paired_device_type_t whose count changed.
+    // Every bit is set for the first report, which has nothing to compare against.
+    uint8_t apply(const gdo_paired_device_t &report, uint32_t now) {
+        uint8_t changed = 0;
+        for (uint8_t type = 0; type < GDO_PAIRED_DEVICE_TYPE_MAX; type++) {
+            const auto count = count_of(report, static_cast<gdo_paired_device_type_t>(type));
+            if (this->known && this->counts[type] == count) {
+                continue;
+            }
+            if (this->known) {
+                this->changed_at[type] = now;
+            }
+            this->counts[type] = count;
+            changed |= 1 << type;
+        }
+        this->known = true;
+        return changed;
+    }
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // SECPLUS_GDO_TRACKS_PAIRED_DEVICES
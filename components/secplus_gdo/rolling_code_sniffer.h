@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+
+#include <cstddef>
+#include <cstdint>
+
+#include "wireline.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Keeps the highest rolling code seen in wireline frames read before gdolib starts. Nothing is transmitted.
+class RollingCodeSniffer {
+public:
+    void feed(const uint8_t *data, size_t len) {
+        WirelinePacket packet;
+        for (size_t i = 0; i < len; i++) {
+            if (!this->framer_.feed_byte(data[i], &packet)) {
+                continue;
+            }
+            if (this->frames_ == 0 || packet.rolling > this->max_rolling_code_) {
+                this->max_rolling_code_ = packet.rolling;
+            }
+            this->frames_++;
+        }
+    }
+
+    uint32_t frames() const { return this->frames_; }
+    uint32_t rejected() const { return this->framer_.rejected(); }
+    bool has_rolling_code() const { return this->frames_ > 0; }
+    uint32_t max_rolling_code() const { return this->max_rolling_code_; }
+
+protected:
+    WirelineFramer framer_{};
+    uint32_t       frames_{0};
+    uint32_t       max_rolling_code_{0};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
@@ -18,10 +18,21 @@
 
 #include "secplus_gdo.h"
 
+#ifdef USE_SECPLUS_GDO
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <sys/time.h>
+
 #include "driver/gpio.h"
+#include "driver/uart.h"
+#include "esphome/core/application.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "inttypes.h"
 
 namespace esphome {
@@ -30,21 +41,178 @@ namespace secplus_gdo {
     constexpr char TAG[] = "secplus_gdo";
     constexpr uint8_t ROLLING_CODE_ANCHOR_RETRIES = 3;
     constexpr uint8_t MAX_DIAGNOSTIC_DRIVER_RESTARTS = 3;
+    constexpr uint32_t DIAGNOSTIC_DRIVER_RESTART_DELAY_MS = 1000;
+    // Logs what the opener reported once startup has had time to sync.
+    constexpr uint32_t STARTUP_STATUS_LOG_MS = 20000;
+    constexpr uart_port_t GDO_UART_NUM = UART_NUM_1;
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+    constexpr int MONITOR_UART_BAUD = 9600;
+    constexpr int MONITOR_UART_RX_BUFFER_SIZE = 256;
+    // The opener reports motion once; the sensor clears after this long without another report.
+    constexpr uint32_t MONITOR_MOTION_CLEAR_MS = 3000;
+#endif
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+    // Headroom over the highest sniffed rolling code for frames sent after the listening window closed.
+    constexpr uint32_t ROLLING_CODE_SNIFF_MARGIN = 8;
+#endif
+    // Anything earlier means the clock has not been set yet (2020-09-13).
+    constexpr time_t CLOCK_SET_MIN_TIME = 1600000000;
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+    // Door health changes are saved at most this often, and the wall-clock day is checked as often.
+    constexpr uint32_t DOOR_HEALTH_SAVE_INTERVAL_MS = 5 * 60 * 1000;
+#endif
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+    // Bounds the formatting work a single loop iteration spends on deferred log records.
+    constexpr size_t DEFERRED_LOG_RECORDS_PER_LOOP = 4;
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+    // Bounds the records a history dump decodes per loop iteration; each matching one is a log line.
+    constexpr size_t HISTORY_DUMP_RECORDS_PER_LOOP = 16;
+#endif
+
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+    static ProfileSlot profile_slot_for_event(gdo_cb_event_t event) {
+        switch (event) {
+        case GDO_CB_EVENT_SYNCED:
+            return ProfileSlot::EVENT_SYNCED;
+        case GDO_CB_EVENT_LIGHT:
+            return ProfileSlot::EVENT_LIGHT;
+        case GDO_CB_EVENT_LOCK:
+            return ProfileSlot::EVENT_LOCK;
+        case GDO_CB_EVENT_DOOR_POSITION:
+            return ProfileSlot::EVENT_DOOR_POSITION;
+        case GDO_CB_EVENT_LEARN:
+            return ProfileSlot::EVENT_LEARN;
+        case GDO_CB_EVENT_OBSTRUCTION:
+            return ProfileSlot::EVENT_OBSTRUCTION;
+        case GDO_CB_EVENT_MOTION:
+            return ProfileSlot::EVENT_MOTION;
+        case GDO_CB_EVENT_BATTERY:
+            return ProfileSlot::EVENT_BATTERY;
+        case GDO_CB_EVENT_BUTTON:
+            return ProfileSlot::EVENT_BUTTON;
+        case GDO_CB_EVENT_MOTOR:
+            return ProfileSlot::EVENT_MOTOR;
+        case GDO_CB_EVENT_OPENINGS:
+            return ProfileSlot::EVENT_OPENINGS;
+        case GDO_CB_EVENT_TTC:
+            return ProfileSlot::EVENT_TTC;
+        case GDO_CB_EVENT_PAIRED_DEVICES:
+            return ProfileSlot::EVENT_PAIRED_DEVICES;
+        case GDO_CB_EVENT_OPEN_DURATION_MEASUREMENT:
+            return ProfileSlot::EVENT_OPEN_DURATION;
+        case GDO_CB_EVENT_CLOSE_DURATION_MEASUREMENT:
+            return ProfileSlot::EVENT_CLOSE_DURATION;
+        default:
+            return ProfileSlot::EVENT_UNKNOWN;
+        }
+    }
+#endif
+
+    // Events with no configured consumer are dropped in the gdolib task instead of being queued for the main loop.
+    // Sync is always handled because it drives the rolling code search; unknown events pass through to be logged.
+    static constexpr bool event_has_entity_consumer(gdo_cb_event_t event) {
+        switch (event) {
+        case GDO_CB_EVENT_SYNCED:
+            return true;
+        case GDO_CB_EVENT_LIGHT:
+            return SECPLUS_GDO_TRACKS_LIGHT;
+        case GDO_CB_EVENT_LOCK:
+            return SECPLUS_GDO_TRACKS_LOCK;
+        case GDO_CB_EVENT_DOOR_POSITION:
+            return SECPLUS_GDO_TRACKS_DOOR;
+        case GDO_CB_EVENT_LEARN:
+            return SECPLUS_GDO_TRACKS_LEARN;
+        case GDO_CB_EVENT_OBSTRUCTION:
+            return SECPLUS_GDO_TRACKS_OBSTRUCTION;
+        case GDO_CB_EVENT_MOTION:
+            return SECPLUS_GDO_TRACKS_MOTION;
+        case GDO_CB_EVENT_BATTERY:
+            return SECPLUS_GDO_TRACKS_BATTERY;
+        case GDO_CB_EVENT_BUTTON:
+            return SECPLUS_GDO_TRACKS_BUTTON;
+        case GDO_CB_EVENT_MOTOR:
+            return SECPLUS_GDO_TRACKS_MOTOR;
+        case GDO_CB_EVENT_OPENINGS:
+            return SECPLUS_GDO_TRACKS_OPENINGS;
+        case GDO_CB_EVENT_TTC:
+            // Time to close is only logged.
+            return ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_INFO;
+        case GDO_CB_EVENT_PAIRED_DEVICES:
+            return SECPLUS_GDO_TRACKS_PAIRED_DEVICES;
+        case GDO_CB_EVENT_OPEN_DURATION_MEASUREMENT:
+            return SECPLUS_GDO_TRACKS_OPEN_DURATION;
+        case GDO_CB_EVENT_CLOSE_DURATION_MEASUREMENT:
+            return SECPLUS_GDO_TRACKS_CLOSE_DURATION;
+        default:
+            return true;
+        }
+    }
 
-    static void process_gdo_event(const gdo_status_t *status, gdo_cb_event_t event, GDOComponent *gdo) {
+    static constexpr bool event_has_history(gdo_cb_event_t event) {
+        switch (event) {
+        case GDO_CB_EVENT_DOOR_POSITION:
+        case GDO_CB_EVENT_LIGHT:
+        case GDO_CB_EVENT_LOCK:
+        case GDO_CB_EVENT_OBSTRUCTION:
+        case GDO_CB_EVENT_MOTION:
+            return SECPLUS_GDO_TRACKS_HISTORY;
+        default:
+            return false;
+        }
+    }
+
+    static constexpr bool event_has_consumer(gdo_cb_event_t event) {
+        return event_has_entity_consumer(event) || event_has_history(event) || SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT;
+    }
+
+    // Lets the gdolib task cut the main loop's idle sleep short instead of waiting for the next iteration.
+    static void wake_main_loop() {
+#ifdef USE_WAKE_LOOP_THREADSAFE
+        App.wake_loop_threadsafe();
+#endif
+    }
+
+    static void process_gdo_event(const QueuedStatus *status, gdo_cb_event_t event, GDOComponent *gdo,
+                                  [[maybe_unused]] bool priority = false) {
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        if (!gdo->accept_event_seq(event, status->seq)) {
+            ESP_LOGV(TAG, "Dropping event %d superseded by a priority event", static_cast<int>(event));
+            return;
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+        gdo->profiler().record_dispatch(priority, micros() - status->queued_us);
+#endif
+        gdo->set_event_time(status->queued_us);
+#ifdef USE_SECPLUS_GDO_HISTORY
+        if (event_has_history(event)) {
+            gdo->record_history(*status, event);
+        }
+#endif
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+        gdo->schedule_status_snapshot();
+#endif
+#if SECPLUS_GDO_TRACKS_HISTORY || SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+        if (!event_has_entity_consumer(event)) {
+            return;
+        }
+#endif
+        GDO_PROFILE_SCOPE(gdo->profiler(), profile_slot_for_event(event));
         switch (event) {
         case GDO_CB_EVENT_SYNCED: {
             const bool has_opener_status = status->door != GDO_DOOR_STATE_UNKNOWN;
             const bool rolling_code_accepted = has_opener_status;
             bool effective_synced = status->synced || rolling_code_accepted;
-            ESP_LOGI(TAG, "Synced: %s, gdolib diagnostic sync: %s, protocol: %s",
+            GDO_LOGI(LogSubsystem::COMPONENT, "Synced: %s, gdolib diagnostic sync: %s, protocol: %s",
                      effective_synced ? "true" : "false", status->synced ? "complete" : "incomplete",
                      gdo_protocol_type_to_string(status->protocol));
             if (status->synced) {
                 gdo->reset_diagnostic_resync_state();
             }
             if (status->protocol == GDO_PROTOCOL_SEC_PLUS_V2) {
-                ESP_LOGI(TAG, "Client ID: %" PRIu32 ", Rolling code: %" PRIu32, status->client_id, status->rolling_code);
+                GDO_LOGI(LogSubsystem::COMPONENT, "Client ID: %" PRIu32 ", Rolling code: %" PRIu32, status->client_id,
+                         status->rolling_code);
                 if (status->synced || has_opener_status) {
                     // Save the last rolling code value proven by the opener for use on reboot.
                     gdo->set_client_id(status->client_id);
@@ -54,7 +222,7 @@ namespace secplus_gdo {
 
             if (!status->synced) {
                 if (rolling_code_accepted) {
-                    ESP_LOGI(TAG,
+                    GDO_LOGI(LogSubsystem::COMPONENT,
                              "Rolling code accepted; opener status received before full diagnostic sync completed, not "
                              "advancing rolling code; restarting gdolib driver to retry diagnostic data sync");
                     gdo->schedule_diagnostic_data_resync();
@@ -62,16 +230,26 @@ namespace secplus_gdo {
                     bool rolling_code_search_advanced = false;
                     const auto next_rolling_code =
                         gdo->next_rolling_code_search_value(status->rolling_code, &rolling_code_search_advanced);
-                    if (gdo_set_rolling_code(next_rolling_code) != ESP_OK) {
+                    esp_err_t rolling_code_err;
+                    {
+                        GDO_PROFILE_SCOPE(gdo->profiler(), ProfileSlot::GDO_SET_ROLLING_CODE);
+                        rolling_code_err = gdo_set_rolling_code(next_rolling_code);
+                    }
+                    if (rolling_code_err != ESP_OK) {
                         ESP_LOGE(TAG, "Failed to set rolling code");
                     } else {
                         if (rolling_code_search_advanced) {
-                            ESP_LOGI(TAG, "Rolling code search advanced to %" PRIu32 ", retrying sync",
-                                     next_rolling_code);
+                            GDO_LOGI(LogSubsystem::COMPONENT,
+                                     "Rolling code search advanced to %" PRIu32 ", retrying sync", next_rolling_code);
                         } else {
-                            ESP_LOGI(TAG, "Retrying rolling code anchor %" PRIu32, next_rolling_code);
+                            GDO_LOGI(LogSubsystem::COMPONENT, "Retrying rolling code anchor %" PRIu32,
+                                     next_rolling_code);
+                        }
+                        esp_err_t err;
+                        {
+                            GDO_PROFILE_SCOPE(gdo->profiler(), ProfileSlot::GDO_SYNC);
+                            err = gdo_sync();
                         }
-                        const auto err = gdo_sync();
                         if (err != ESP_OK) {
                             ESP_LOGE(TAG, "Failed to start resync: %s", esp_err_to_name(err));
                         }
@@ -84,53 +262,76 @@ namespace secplus_gdo {
             gdo->set_sync_state(effective_synced);
             break;
         }
+#if SECPLUS_GDO_TRACKS_LIGHT
         case GDO_CB_EVENT_LIGHT:
             gdo->set_light_state(status->light);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_LOCK
         case GDO_CB_EVENT_LOCK:
             gdo->set_lock_state(status->lock);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR
         case GDO_CB_EVENT_DOOR_POSITION: {
             const float position = static_cast<float>(10000 - status->door_position) / 10000.0f;
             gdo->set_door_state(status->door, position);
+#if SECPLUS_GDO_TRACKS_MOTOR
             if (status->door != GDO_DOOR_STATE_OPENING && status->door != GDO_DOOR_STATE_CLOSING) {
                 gdo->set_motor_state(GDO_MOTOR_STATE_OFF);
             }
+#endif
             break;
         }
+#endif
+#if SECPLUS_GDO_TRACKS_LEARN
         case GDO_CB_EVENT_LEARN:
-            ESP_LOGI(TAG, "Learn: %s", gdo_learn_state_to_string(status->learn));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Learn: %s", gdo_learn_state_to_string(status->learn));
             gdo->set_learn_state(status->learn);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_OBSTRUCTION
         case GDO_CB_EVENT_OBSTRUCTION:
-            ESP_LOGI(TAG, "Obstruction: %s", gdo_obstruction_state_to_string(status->obstruction));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Obstruction: %s", gdo_obstruction_state_to_string(status->obstruction));
             gdo->set_obstruction(status->obstruction);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_MOTION
         case GDO_CB_EVENT_MOTION:
-            ESP_LOGI(TAG, "Motion: %s", gdo_motion_state_to_string(status->motion));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Motion: %s", gdo_motion_state_to_string(status->motion));
             gdo->set_motion_state(status->motion);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_BATTERY
         case GDO_CB_EVENT_BATTERY:
-            ESP_LOGI(TAG, "Battery: %s", gdo_battery_state_to_string(status->battery));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Battery: %s", gdo_battery_state_to_string(status->battery));
             gdo->set_battery_state(status->battery);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_BUTTON
         case GDO_CB_EVENT_BUTTON:
-            ESP_LOGI(TAG, "Button: %s", gdo_button_state_to_string(status->button));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Button: %s", gdo_button_state_to_string(status->button));
             gdo->set_button_state(status->button);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_MOTOR
         case GDO_CB_EVENT_MOTOR:
-            ESP_LOGI(TAG, "Motor: %s", gdo_motor_state_to_string(status->motor));
+            GDO_LOGI(LogSubsystem::COMPONENT, "Motor: %s", gdo_motor_state_to_string(status->motor));
             gdo->set_motor_state(status->motor);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_OPENINGS
         case GDO_CB_EVENT_OPENINGS:
-            ESP_LOGI(TAG, "Openings: %" PRIu16, status->openings);
+            GDO_LOGI(LogSubsystem::COMPONENT, "Openings: %" PRIu16, status->openings);
             gdo->set_openings(status->openings);
             break;
+#endif
         case GDO_CB_EVENT_TTC:
-            ESP_LOGI(TAG, "Time to close: %" PRIu16, status->ttc_seconds);
+            GDO_LOGI(LogSubsystem::COMPONENT, "Time to close: %" PRIu16, status->ttc_seconds);
             break;
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
         case GDO_CB_EVENT_PAIRED_DEVICES:
-            ESP_LOGI(TAG,
+            GDO_LOGI(LogSubsystem::COMPONENT,
                      "Paired devices: %" PRIu8 " remotes, %" PRIu8 " keypads, %" PRIu8 " wall controls, %" PRIu8
                      " accessories, %" PRIu8 " total",
                      status->paired_devices.total_remotes, status->paired_devices.total_keypads,
@@ -138,16 +339,21 @@ namespace secplus_gdo {
                      status->paired_devices.total_all);
             gdo->set_paired_devices(status->paired_devices);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_OPEN_DURATION
         case GDO_CB_EVENT_OPEN_DURATION_MEASUREMENT:
-            ESP_LOGI(TAG, "Open duration: %" PRIu16, status->open_ms);
+            GDO_LOGI(LogSubsystem::COMPONENT, "Open duration: %" PRIu16, status->open_ms);
             gdo->set_open_duration(status->open_ms);
             break;
+#endif
+#if SECPLUS_GDO_TRACKS_CLOSE_DURATION
         case GDO_CB_EVENT_CLOSE_DURATION_MEASUREMENT:
-            ESP_LOGI(TAG, "Close duration: %" PRIu16, status->close_ms);
+            GDO_LOGI(LogSubsystem::COMPONENT, "Close duration: %" PRIu16, status->close_ms);
             gdo->set_close_duration(status->close_ms);
             break;
+#endif
         default:
-            ESP_LOGI(TAG, "Unknown event: %d", event);
+            GDO_LOGI(LogSubsystem::COMPONENT, "Unknown event: %d", static_cast<int>(event));
             break;
         }
     }
@@ -158,102 +364,320 @@ namespace secplus_gdo {
             ESP_LOGE(TAG, "Received invalid callback state from gdolib");
             return;
         }
+        gdo->apply_task_priority();
+        gdo->mirror_status(*status, event);
+        if (!event_has_consumer(event)) {
+            return;
+        }
 
         gdo->defer_gdo_event(*status, event);
     }
 
-    void GDOComponent::defer_gdo_event(const gdo_status_t &status, gdo_cb_event_t event) {
-        this->defer([this, status, event]() { process_gdo_event(&status, event, this); });
+    void GDOComponent::apply_task_priority() {
+        if (this->task_priority_ == 0 || this->task_priority_applied_.exchange(true)) {
+            return;
+        }
+        vTaskPrioritySet(nullptr, this->task_priority_);
+    }
+
+    void GDOComponent::defer_gdo_event(const gdo_status_t &gdo_status, gdo_cb_event_t event) {
+        QueuedStatus status{};
+        static_cast<gdo_status_t &>(status) = gdo_status;
+        status.queued_us = micros();
+        status.seq = ++this->event_seq_;
+
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        if (is_priority_event(status, event) && this->priority_events_.push(status, event)) {
+            wake_main_loop();
+            return;
+        }
+#endif
+        this->defer([this, status, event]() {
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+            // Anything that jumped the queue is handled before this older event.
+            this->drain_priority_events_();
+#endif
+            process_gdo_event(&status, event, this);
+        });
+        wake_main_loop();
+    }
+
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+    void GDOComponent::drain_priority_events_() {
+        PriorityEventQueue<PRIORITY_EVENT_QUEUE_SIZE>::Entry entry;
+        while (this->priority_events_.pop(&entry)) {
+            process_gdo_event(&entry.status, entry.event, this, true);
+        }
+    }
+
+    bool GDOComponent::accept_event_seq(gdo_cb_event_t event, uint32_t seq) {
+        size_t index;
+        switch (event) {
+        case GDO_CB_EVENT_DOOR_POSITION:
+            index = 0;
+            break;
+        case GDO_CB_EVENT_OBSTRUCTION:
+            index = 1;
+            break;
+        default:
+            return true;
+        }
+
+        if (static_cast<int32_t>(seq - this->last_event_seq_[index]) < 0) {
+            return false;
+        }
+        this->last_event_seq_[index] = seq;
+        return true;
     }
+#endif
 
     void GDOComponent::start_gdo() {
         this->start_if_ready_();
     }
 
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR
     void GDOComponent::register_binary_sensor(GDOBinarySensor *sensor) {
         if (sensor == nullptr) {
             return;
         }
 
         switch (sensor->get_type()) {
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTION
         case GDOBinarySensorType::MOTION:
             this->motion_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_OBSTRUCTION
         case GDOBinarySensorType::OBSTRUCTION:
             this->obstruction_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTOR
         case GDOBinarySensorType::MOTOR:
             this->motor_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_BUTTON
         case GDOBinarySensorType::BUTTON:
             this->button_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_SYNC
         case GDOBinarySensorType::SYNC:
             this->sync_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_WIRELESS_REMOTE
         case GDOBinarySensorType::WIRELESS_REMOTE:
             this->wireless_remote_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_TRAVEL_DRIFT
+        case GDOBinarySensorType::TRAVEL_DRIFT:
+            this->travel_drift_sensor_ = sensor;
+            break;
+#endif
+        default:
+            break;
         }
     }
+#endif
 
+#ifdef USE_SECPLUS_GDO_SENSOR
     void GDOComponent::register_sensor(GDOStat *sensor) {
         if (sensor == nullptr) {
             return;
         }
 
         switch (sensor->get_type()) {
+#ifdef USE_SECPLUS_GDO_SENSOR_OPENINGS
         case GDOStatType::OPENINGS:
             this->openings_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_TOTAL
         case GDOStatType::PAIRED_DEVICES_TOTAL:
             this->paired_total_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_REMOTES
         case GDOStatType::PAIRED_DEVICES_REMOTES:
             this->paired_remotes_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_KEYPADS
         case GDOStatType::PAIRED_DEVICES_KEYPADS:
             this->paired_keypads_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_WALL_CONTROLS
         case GDOStatType::PAIRED_DEVICES_WALL_CONTROLS:
             this->paired_wall_controls_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_ACCESSORIES
         case GDOStatType::PAIRED_DEVICES_ACCESSORIES:
             this->paired_accessories_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_TRIGGER_LATENCY
+        case GDOStatType::TRIGGER_LATENCY:
+            this->trigger_latency_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_PIN_LEAD
+        case GDOStatType::OBSTRUCTION_PIN_LEAD:
+            this->obstruction_pin_lead_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CALIBRATION_PROGRESS
+        case GDOStatType::CALIBRATION_PROGRESS:
+            this->calibration_progress_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_COMMAND_LATENCY
+        case GDOStatType::COMMAND_LATENCY:
+            this->command_latency_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_UNACKNOWLEDGED_COMMANDS
+        case GDOStatType::UNACKNOWLEDGED_COMMANDS:
+            this->unacknowledged_commands_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_AVERAGE
+        case GDOStatType::OPEN_TIME_AVERAGE:
+            this->open_time_average_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_AVERAGE
+        case GDOStatType::CLOSE_TIME_AVERAGE:
+            this->close_time_average_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_P90
+        case GDOStatType::OPEN_TIME_P90:
+            this->open_time_p90_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_P90
+        case GDOStatType::CLOSE_TIME_P90:
+            this->close_time_p90_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CYCLES_PER_DAY
+        case GDOStatType::CYCLES_PER_DAY:
+            this->cycles_per_day_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_RATE
+        case GDOStatType::OBSTRUCTION_RATE:
+            this->obstruction_rate_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_REVERSAL_TIME
+        case GDOStatType::REVERSAL_TIME:
+            this->reversal_time_sensor_ = sensor;
+            break;
+#endif
+        default:
+            break;
         }
     }
+#endif
 
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR
     void GDOComponent::register_text_sensor(GDOTextSensor *sensor) {
         if (sensor == nullptr) {
             return;
         }
 
         switch (sensor->get_type()) {
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_BATTERY
         case GDOTextSensorType::BATTERY:
             this->battery_sensor_ = sensor;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_LAST_TRIGGER_SOURCE
+        case GDOTextSensorType::LAST_TRIGGER_SOURCE:
+            this->trigger_source_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_STATUS_SNAPSHOT
+        case GDOTextSensorType::STATUS_SNAPSHOT:
+            this->status_snapshot_sensor_ = sensor;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_AUTO_CLOSE_TIME
+        case GDOTextSensorType::AUTO_CLOSE_TIME:
+            this->auto_close_time_sensor_ = sensor;
+            break;
+#endif
+        default:
+            break;
         }
     }
+#endif
+
+#ifdef USE_SECPLUS_GDO_EVENT
+    void GDOComponent::register_event(GDOEvent *event) {
+        if (event == nullptr) {
+            return;
+        }
 
+        switch (event->get_type()) {
+#ifdef USE_SECPLUS_GDO_EVENT_BUTTON
+        case GDOEventType::BUTTON:
+            this->button_event_ = event;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_WIRELESS_REMOTE
+        case GDOEventType::WIRELESS_REMOTE:
+            this->wireless_remote_event_ = event;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_MOTION
+        case GDOEventType::MOTION:
+            this->motion_event_ = event;
+            break;
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_OBSTRUCTION
+        case GDOEventType::OBSTRUCTION:
+            this->obstruction_event_ = event;
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+#endif
+
+#ifdef USE_SECPLUS_GDO_NUMBER
     void GDOComponent::register_number(GDONumber *num) {
         if (num == nullptr) {
             return;
         }
 
         switch (num->get_type()) {
+#ifdef USE_SECPLUS_GDO_NUMBER_OPEN_DURATION
         case GDONumberType::OPEN_DURATION:
             this->open_duration_ = num;
             num->set_control_function([](double value) { return gdo_set_open_duration(static_cast<uint16_t>(value)); });
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION
         case GDONumberType::CLOSE_DURATION:
             this->close_duration_ = num;
             num->set_control_function([](double value) { return gdo_set_close_duration(static_cast<uint16_t>(value)); });
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLIENT_ID
         case GDONumberType::CLIENT_ID:
             this->client_id_ = num;
             num->set_control_function([](double value) { return gdo_set_client_id(static_cast<uint32_t>(value)); });
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_ROLLING_CODE
         case GDONumberType::ROLLING_CODE:
             this->rolling_code_ = num;
             num->set_control_function([this](double value) {
@@ -265,101 +689,475 @@ namespace secplus_gdo {
                 return err;
             });
             break;
+#endif
+        default:
+            break;
         }
     }
+#endif
 
+#ifdef USE_SECPLUS_GDO_SWITCH
     void GDOComponent::register_switch(GDOSwitch *sw) {
         if (sw == nullptr) {
             return;
         }
 
         switch (sw->get_type()) {
+#ifdef USE_SECPLUS_GDO_SWITCH_LEARN
         case SwitchType::LEARN:
             this->learn_switch_ = sw;
             break;
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH_TOGGLE_ONLY
         case SwitchType::TOGGLE_ONLY:
             this->toggle_only_switch_ = sw;
             break;
+#endif
+        default:
+            break;
         }
     }
+#endif
 
+#if SECPLUS_GDO_TRACKS_MOTION
     void GDOComponent::set_motion_state(gdo_motion_state_t state) {
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTION
         if (this->motion_sensor_ != nullptr) {
             this->motion_sensor_->publish(state == GDO_MOTION_STATE_DETECTED);
         }
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_MOTION
+        if (this->motion_event_ != nullptr && state == GDO_MOTION_STATE_DETECTED) {
+            this->motion_event_->fire("motion", this->event_time_us_);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_AUTO_CLOSE
+        if (this->door_ != nullptr && state == GDO_MOTION_STATE_DETECTED) {
+            this->door_->report_motion();
+        }
+#endif
     }
+#endif
 
+#if SECPLUS_GDO_TRACKS_OBSTRUCTION
     void GDOComponent::set_obstruction(gdo_obstruction_state_t state) {
+        const bool obstructed = state == GDO_OBSTRUCTION_STATE_OBSTRUCTED;
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        this->compare_obstruction_paths_(ObstructionPathCompare::STATUS, obstructed, millis());
+#endif
+        this->publish_obstruction_(obstructed, this->event_time_us_);
+    }
+
+    void GDOComponent::publish_obstruction_(bool obstructed, [[maybe_unused]] uint32_t at_us) {
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        // Counted once per obstruction even when both the pin and the status report it.
+        if (obstructed != this->health_obstructed_) {
+            this->health_obstructed_ = obstructed;
+            if (obstructed) {
+                this->door_health_.record_obstruction();
+                this->door_health_changed_();
+            }
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_COVER
+        if (this->door_ != nullptr) {
+            this->door_->report_obstruction(obstructed, at_us);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_OBSTRUCTION
         if (this->obstruction_sensor_ != nullptr) {
-            this->obstruction_sensor_->publish(state == GDO_OBSTRUCTION_STATE_OBSTRUCTED);
+            this->obstruction_sensor_->publish(obstructed);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_OBSTRUCTION
+        const auto state = obstructed ? GDO_OBSTRUCTION_STATE_OBSTRUCTED : GDO_OBSTRUCTION_STATE_CLEAR;
+        if (state != this->obstruction_event_state_) {
+            // The first report only sets the baseline unless it is an obstruction.
+            const bool first = this->obstruction_event_state_ == GDO_OBSTRUCTION_STATE_MAX;
+            this->obstruction_event_state_ = state;
+            if (this->obstruction_event_ != nullptr && (obstructed || !first)) {
+                this->obstruction_event_->fire(obstructed ? "obstructed" : "cleared", at_us);
+            }
         }
+#endif
     }
+#endif
+
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+    void GDOComponent::poll_obstruction_pin_() {
+        uint32_t at_us = 0;
+        const auto reading = this->obstruction_input_.poll(micros(), &at_us);
+        if (reading == ObstructionInput::Reading::NONE) {
+            return;
+        }
 
+        const bool obstructed = reading == ObstructionInput::Reading::OBSTRUCTED;
+        const uint32_t at_ms = millis() - (micros() - at_us) / 1000;
+        GDO_LOGI(LogSubsystem::COMPONENT, "Obstruction pin: %s", obstructed ? "obstructed" : "clear");
+        this->compare_obstruction_paths_(ObstructionPathCompare::PIN, obstructed, at_ms);
+        this->publish_obstruction_(obstructed, at_us);
+    }
+
+    void GDOComponent::compare_obstruction_paths_(ObstructionPathCompare::Path path, bool obstructed,
+                                                  uint32_t at_ms) {
+        int32_t lead_ms = 0;
+        if (!this->obstruction_compare_.record(path, obstructed, at_ms, &lead_ms)) {
+            return;
+        }
+
+        ESP_LOGD(TAG, "Obstruction pin %s opener status by %" PRId32 " ms", lead_ms >= 0 ? "led" : "trailed",
+                 lead_ms >= 0 ? lead_ms : -lead_ms);
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_PIN_LEAD
+        if (this->obstruction_pin_lead_sensor_ != nullptr) {
+            this->obstruction_pin_lead_sensor_->publish_state(lead_ms);
+        }
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_BUTTON
     void GDOComponent::set_button_state(gdo_button_state_t state) {
         if (state == GDO_BUTTON_STATE_PRESSED) {
-            this->button_triggered_ = true;
+#if SECPLUS_GDO_TRACKS_MOTOR
+            this->attribution_.record(TriggerSource::WALL_BUTTON, millis());
+#endif
+#ifdef USE_SECPLUS_GDO_COVER
             if (this->door_ != nullptr) {
                 this->door_->cancel_pre_close_warning();
             }
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_BUTTON
+            if (this->button_event_ != nullptr) {
+                this->button_event_->fire("press", this->event_time_us_);
+            }
+#endif
         }
 
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_BUTTON
         if (this->button_sensor_ != nullptr) {
             this->button_sensor_->publish(state == GDO_BUTTON_STATE_PRESSED);
         }
+#endif
     }
+#endif
 
+#if SECPLUS_GDO_TRACKS_MOTOR
     void GDOComponent::set_motor_state(gdo_motor_state_t state) {
+        const bool running = state == GDO_MOTOR_STATE_ON;
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTOR
         if (this->motor_sensor_ != nullptr) {
-            this->motor_sensor_->publish(state == GDO_MOTOR_STATE_ON);
+            this->motor_sensor_->publish(running);
         }
+#endif
 
-        if (state == GDO_MOTOR_STATE_ON) {
-            if (!this->button_triggered_ && !this->cover_triggered_ && this->wireless_remote_sensor_ != nullptr) {
+        if (running == this->motor_running_) {
+            return;
+        }
+        this->motor_running_ = running;
+
+        if (!running) {
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_WIRELESS_REMOTE
+            // The remote indication follows the movement it caused instead of a fixed-length pulse.
+            if (this->wireless_remote_active_ && this->wireless_remote_sensor_ != nullptr) {
+                this->wireless_remote_sensor_->publish(false);
+            }
+#endif
+            this->wireless_remote_active_ = false;
+            return;
+        }
+
+        uint32_t latency_ms = 0;
+        const auto source = this->attribution_.attribute(millis(), &latency_ms);
+        if (source == TriggerSource::WIRELESS_REMOTE) {
+            this->wireless_remote_active_ = true;
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_WIRELESS_REMOTE
+            if (this->wireless_remote_sensor_ != nullptr) {
                 this->wireless_remote_sensor_->publish(true);
-                this->set_timeout("wireless_remote_off", 500, [this]() {
-                    if (this->wireless_remote_sensor_ != nullptr) {
-                        this->wireless_remote_sensor_->publish(false);
-                    }
-                });
             }
-            this->button_triggered_ = false;
-            this->cover_triggered_ = false;
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_WIRELESS_REMOTE
+            if (this->wireless_remote_event_ != nullptr) {
+                this->wireless_remote_event_->fire("activation", this->event_time_us_);
+            }
+#endif
+            this->publish_trigger_source_(source, nullptr);
+        } else {
+            this->publish_trigger_source_(source, &latency_ms);
         }
     }
 
+    void GDOComponent::publish_trigger_source_(TriggerSource source, const uint32_t *latency_ms) {
+        if (latency_ms != nullptr) {
+            ESP_LOGD(TAG, "Motor start attributed to %s after %" PRIu32 " ms", trigger_source_to_string(source),
+                     *latency_ms);
+        } else {
+            ESP_LOGD(TAG, "Motor start attributed to %s", trigger_source_to_string(source));
+        }
+
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_LAST_TRIGGER_SOURCE
+        if (this->trigger_source_sensor_ != nullptr) {
+            this->trigger_source_sensor_->update_state(trigger_source_to_string(source));
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_TRIGGER_LATENCY
+        if (this->trigger_latency_sensor_ != nullptr) {
+            if (latency_ms != nullptr) {
+                this->trigger_latency_sensor_->update_state(*latency_ms);
+            } else {
+                this->trigger_latency_sensor_->publish_unknown();
+            }
+        }
+#endif
+    }
+#endif
+
+#if defined(USE_SECPLUS_GDO_LIGHT) || defined(USE_SECPLUS_GDO_LOCK)
+    void GDOComponent::record_command_outcome_(bool confirmed, [[maybe_unused]] uint32_t latency_ms) {
+        if (confirmed) {
+#ifdef USE_SECPLUS_GDO_SENSOR_COMMAND_LATENCY
+            if (this->command_latency_sensor_ != nullptr) {
+                this->command_latency_sensor_->update_state(latency_ms);
+            }
+#endif
+            return;
+        }
+
+        this->unacknowledged_commands_++;
+#ifdef USE_SECPLUS_GDO_SENSOR_UNACKNOWLEDGED_COMMANDS
+        if (this->unacknowledged_commands_sensor_ != nullptr) {
+            this->unacknowledged_commands_sensor_->update_state(this->unacknowledged_commands_);
+        }
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_BATTERY
     void GDOComponent::set_battery_state(gdo_battery_state_t state) {
         if (this->battery_sensor_ != nullptr && state != GDO_BATT_STATE_UNKNOWN) {
             this->battery_sensor_->update_state(gdo_battery_state_to_string(state));
         }
     }
+#endif
+
+#if SECPLUS_GDO_TRACKS_OPENINGS
+    void GDOComponent::set_openings(uint16_t openings) {
+#ifdef USE_SECPLUS_GDO_SENSOR_OPENINGS
+        if (this->openings_sensor_ != nullptr) {
+            this->openings_sensor_->update_state(openings);
+        }
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        if (this->door_health_.record_openings(openings)) {
+            this->door_health_changed_();
+        }
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_OPEN_DURATION
+    void GDOComponent::set_open_duration(uint16_t ms) {
+#ifdef USE_SECPLUS_GDO_NUMBER_OPEN_DURATION
+        if (this->open_duration_ != nullptr) {
+            this->open_duration_->update_state(ms);
+        }
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        this->record_travel_(DoorHealth::OPENING, ms);
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_CLOSE_DURATION
+    void GDOComponent::set_close_duration(uint16_t ms) {
+#ifdef USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION
+        if (this->close_duration_ != nullptr) {
+            this->close_duration_->update_state(ms);
+        }
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        this->record_travel_(DoorHealth::CLOSING, ms);
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+    void GDOComponent::load_door_health_() {
+        this->door_health_pref_ = global_preferences->make_preference<DoorHealth>(fnv1_hash("secplus_gdo_door_health"));
+        DoorHealth saved;
+        if (this->door_health_pref_.load(&saved) && saved.version == DoorHealth::VERSION) {
+            this->door_health_ = saved;
+            ESP_LOGD(TAG, "Restored door health: %" PRIu32 " cycles, %" PRIu32 " obstructions", saved.cycles,
+                     saved.obstructions);
+        }
+        this->publish_door_health_();
+        this->set_interval("door_health", DOOR_HEALTH_SAVE_INTERVAL_MS, [this]() { this->update_door_health_(); });
+    }
+
+    void GDOComponent::record_travel_(DoorHealth::Direction direction, uint16_t ms) {
+        // The opener reports 0 until it has measured a full run.
+        if (ms == 0) {
+            return;
+        }
+        const bool was_drifting = this->door_health_.drifting();
+        this->door_health_.travel[direction].add(ms);
+        if (this->door_health_.drifting() != was_drifting) {
+            ESP_LOGW(TAG, "Door travel time %s", was_drifting ? "back to normal" : "is drifting slower");
+        }
+        this->door_health_changed_();
+    }
+
+    void GDOComponent::door_health_changed_() {
+        this->door_health_dirty_ = true;
+        this->publish_door_health_();
+    }
+
+    void GDOComponent::update_door_health_() {
+        // Days follow the wall clock from the saved start of the day, so reboots do not restart them.
+        const auto now = ::time(nullptr);
+        const uint32_t day_start = this->door_health_.day_start;
+        if (this->door_health_.roll_days(now > CLOCK_SET_MIN_TIME ? static_cast<uint32_t>(now) : 0)) {
+            this->door_health_changed_();
+        } else if (this->door_health_.day_start != day_start) {
+            this->door_health_dirty_ = true;
+        }
+        if (this->door_health_dirty_) {
+            this->save_door_health_();
+        }
+    }
+
+    void GDOComponent::save_door_health_() {
+        this->door_health_pref_.save(&this->door_health_);
+        this->door_health_dirty_ = false;
+    }
+
+    void GDOComponent::publish_door_health_() {
+        [[maybe_unused]] const auto &health = this->door_health_;
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_AVERAGE
+        if (this->open_time_average_sensor_ != nullptr) {
+            this->open_time_average_sensor_->publish_state(health.travel[DoorHealth::OPENING].average_ms());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_AVERAGE
+        if (this->close_time_average_sensor_ != nullptr) {
+            this->close_time_average_sensor_->publish_state(health.travel[DoorHealth::CLOSING].average_ms());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_P90
+        if (this->open_time_p90_sensor_ != nullptr) {
+            this->open_time_p90_sensor_->publish_state(health.travel[DoorHealth::OPENING].p90_ms());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_P90
+        if (this->close_time_p90_sensor_ != nullptr) {
+            this->close_time_p90_sensor_->publish_state(health.travel[DoorHealth::CLOSING].p90_ms());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CYCLES_PER_DAY
+        if (this->cycles_per_day_sensor_ != nullptr) {
+            this->cycles_per_day_sensor_->publish_state(health.daily_cycles());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_RATE
+        if (this->obstruction_rate_sensor_ != nullptr) {
+            this->obstruction_rate_sensor_->publish_state(health.obstructions_per_100_cycles());
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_TRAVEL_DRIFT
+        if (this->travel_drift_sensor_ != nullptr) {
+            this->travel_drift_sensor_->publish(health.drifting());
+        }
+#endif
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
+    void GDOComponent::set_paired_devices(const gdo_paired_device_t &paired_devices) {
+        // Before the clock is set, time() counts from boot and is not worth keeping.
+        const auto now = ::time(nullptr);
+        const uint32_t changed_at = now > CLOCK_SET_MIN_TIME ? static_cast<uint32_t>(now) : 0;
+        const uint8_t changed = this->paired_inventory_.apply(paired_devices, changed_at);
+        if (changed == 0) {
+            ESP_LOGV(TAG, "Paired devices unchanged");
+            return;
+        }
+
+        this->paired_inventory_pref_.save(&this->paired_inventory_);
+        this->publish_paired_inventory_(changed);
+    }
+
+    void GDOComponent::load_paired_inventory_() {
+        this->paired_inventory_pref_ =
+            global_preferences->make_preference<PairedInventory>(fnv1_hash("secplus_gdo_paired_inventory"));
+        PairedInventory saved;
+        if (!this->paired_inventory_pref_.load(&saved) || !saved.known) {
+            return;
+        }
+
+        this->paired_inventory_ = saved;
+        ESP_LOGD(TAG, "Restored paired devices: %" PRIu8 " total", saved.counts[GDO_PAIRED_DEVICE_TYPE_ALL]);
+        this->publish_paired_inventory_(UINT8_MAX);
+    }
+
+    void GDOComponent::publish_paired_inventory_(uint8_t changed) {
+        const auto &counts = this->paired_inventory_.counts;
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_TOTAL
+        if (this->paired_total_sensor_ != nullptr && (changed & (1 << GDO_PAIRED_DEVICE_TYPE_ALL))) {
+            this->paired_total_sensor_->update_state(counts[GDO_PAIRED_DEVICE_TYPE_ALL]);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_REMOTES
+        if (this->paired_remotes_sensor_ != nullptr && (changed & (1 << GDO_PAIRED_DEVICE_TYPE_REMOTE))) {
+            this->paired_remotes_sensor_->update_state(counts[GDO_PAIRED_DEVICE_TYPE_REMOTE]);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_KEYPADS
+        if (this->paired_keypads_sensor_ != nullptr && (changed & (1 << GDO_PAIRED_DEVICE_TYPE_KEYPAD))) {
+            this->paired_keypads_sensor_->update_state(counts[GDO_PAIRED_DEVICE_TYPE_KEYPAD]);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_WALL_CONTROLS
+        if (this->paired_wall_controls_sensor_ != nullptr && (changed & (1 << GDO_PAIRED_DEVICE_TYPE_WALL_CONTROL))) {
+            this->paired_wall_controls_sensor_->update_state(counts[GDO_PAIRED_DEVICE_TYPE_WALL_CONTROL]);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_ACCESSORIES
+        if (this->paired_accessories_sensor_ != nullptr && (changed & (1 << GDO_PAIRED_DEVICE_TYPE_ACCESSORY))) {
+            this->paired_accessories_sensor_->update_state(counts[GDO_PAIRED_DEVICE_TYPE_ACCESSORY]);
+        }
+#endif
+    }
+#endif
 
-    void GDOComponent::set_openings(uint16_t openings) {
-        if (this->openings_sensor_ != nullptr) {
-            this->openings_sensor_->update_state(openings);
+    esp_err_t GDOComponent::clear_paired_devices(gdo_paired_device_type_t type) {
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        ESP_LOGW(TAG, "Cannot clear paired devices in monitor-only mode");
+        return ESP_ERR_NOT_SUPPORTED;
+#else
+        const auto err = gdo_clear_paired_devices(type);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to clear paired devices: %s", esp_err_to_name(err));
+            return err;
         }
+
+        ESP_LOGI(TAG, "Cleared paired devices: %s", gdo_paired_device_type_to_string(type));
+        return ESP_OK;
+#endif
     }
 
-    void GDOComponent::set_paired_devices(const gdo_paired_device_t &paired_devices) {
-        if (this->paired_total_sensor_ != nullptr) {
-            this->paired_total_sensor_->update_state(paired_devices.total_all);
-        }
-        if (this->paired_remotes_sensor_ != nullptr) {
-            this->paired_remotes_sensor_->update_state(paired_devices.total_remotes);
-        }
-        if (this->paired_keypads_sensor_ != nullptr) {
-            this->paired_keypads_sensor_->update_state(paired_devices.total_keypads);
-        }
-        if (this->paired_wall_controls_sensor_ != nullptr) {
-            this->paired_wall_controls_sensor_->update_state(paired_devices.total_wall_controls);
-        }
-        if (this->paired_accessories_sensor_ != nullptr) {
-            this->paired_accessories_sensor_->update_state(paired_devices.total_accessories);
+#if SECPLUS_GDO_TRACKS_LEARN
+    void GDOComponent::set_learn_state(gdo_learn_state_t state) {
+#ifdef USE_SECPLUS_GDO_SWITCH_LEARN
+        if (this->learn_switch_ != nullptr) {
+            this->learn_switch_->publish_state_from_device(state == GDO_LEARN_STATE_ACTIVE);
         }
+#endif
     }
+#endif
 
     esp_err_t GDOComponent::init_driver_() {
+        GDO_PROFILE_SCOPE(this->profiler_, ProfileSlot::GDO_INIT);
         gdo_config_t gdo_conf = {
-            .uart_num = UART_NUM_1,
+            .uart_num = GDO_UART_NUM,
             .obst_from_status = true,
             .invert_uart = true,
             .uart_tx_pin = (gpio_num_t) GDO_UART_TX_PIN,
@@ -368,10 +1166,25 @@ namespace secplus_gdo {
         };
 
         const auto err = gdo_init(&gdo_conf);
-        if (err == ESP_OK) {
-            this->initialized_ = true;
+        if (err != ESP_OK) {
+            return err;
         }
-        return err;
+        this->initialized_ = true;
+
+        // gdolib installs the UART driver; only the interrupt thresholds can be changed once it is running.
+        if (this->uart_rx_full_threshold_ != 0) {
+            const auto threshold_err = uart_set_rx_full_threshold(gdo_conf.uart_num, this->uart_rx_full_threshold_);
+            if (threshold_err != ESP_OK) {
+                ESP_LOGW(TAG, "Failed to set UART RX full threshold: %s", esp_err_to_name(threshold_err));
+            }
+        }
+        if (this->uart_rx_timeout_ != 0) {
+            const auto timeout_err = uart_set_rx_timeout(gdo_conf.uart_num, this->uart_rx_timeout_);
+            if (timeout_err != ESP_OK) {
+                ESP_LOGW(TAG, "Failed to set UART RX timeout: %s", esp_err_to_name(timeout_err));
+            }
+        }
+        return ESP_OK;
     }
 
     void GDOComponent::release_uart_tx_pin_to_safe_state_() {
@@ -384,23 +1197,29 @@ namespace secplus_gdo {
 
     void GDOComponent::sync_toggle_only_() {
         bool toggle_only = this->status_.toggle_only;
+#ifdef USE_SECPLUS_GDO_SWITCH_TOGGLE_ONLY
         if (this->toggle_only_switch_ != nullptr) {
             this->toggle_only_switch_->set_control_function([this](bool state) {
                 this->status_.toggle_only = state;
+#ifdef USE_SECPLUS_GDO_COVER
                 if (this->door_ != nullptr) {
                     this->door_->set_toggle_only(state);
                 }
+#endif
                 if (this->initialized_) {
                     gdo_set_toggle_only(state);
                 }
             });
             toggle_only = this->toggle_only_switch_->state;
         }
+#endif
 
         this->status_.toggle_only = toggle_only;
+#ifdef USE_SECPLUS_GDO_COVER
         if (this->door_ != nullptr) {
             this->door_->set_toggle_only(toggle_only);
         }
+#endif
         if (this->initialized_) {
             gdo_set_toggle_only(toggle_only);
         }
@@ -410,7 +1229,14 @@ namespace secplus_gdo {
         if (!this->initialized_ || this->started_) {
             return;
         }
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        if (this->rolling_code_sniffing_) {
+            return;
+        }
+#endif
 
+        // A restarted driver runs in a new task that needs the priority applied again.
+        this->task_priority_applied_.store(false);
         const auto err = gdo_start(gdo_event_handler, this);
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to start secplus GDO: %s", esp_err_to_name(err));
@@ -423,6 +1249,35 @@ namespace secplus_gdo {
 
     void GDOComponent::setup() {
         this->status_ = {};
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
+        this->load_paired_inventory_();
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        this->load_door_health_();
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        if (this->history_.begin(this->history_partition_, millis(), 0)) {
+            this->set_interval("history_flush", this->history_flush_interval_, [this]() { this->history_.flush(); });
+        }
+#endif
+
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        // gdolib is never initialized: the TX stage stays released and the opener is only listened to.
+        this->release_uart_tx_pin_to_safe_state_();
+        const auto monitor_err = this->install_monitor_uart_();
+        if (monitor_err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set up monitor UART: %s", esp_err_to_name(monitor_err));
+            this->mark_failed();
+            return;
+        }
+        this->status_.protocol = GDO_PROTOCOL_SEC_PLUS_V2;
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        if (this->obstruction_pin_ != nullptr) {
+            this->obstruction_input_.setup(this->obstruction_pin_);
+        }
+#endif
+        return;
+#endif
 
         // Initialize the driver first so child entities can restore saved preferences before we start it.
         const auto init_err = this->init_driver_();
@@ -441,13 +1296,75 @@ namespace secplus_gdo {
         }
 
         this->sync_toggle_only_();
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        if (this->obstruction_pin_ != nullptr) {
+            this->obstruction_input_.setup(this->obstruction_pin_);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        if (this->rolling_code_sniff_duration_ > 0) {
+            // gdolib has installed the UART driver but its task is not running yet, so the wire can be read here
+            // without transmitting while child entities restore their preferences.
+            this->rolling_code_sniffing_ = true;
+            this->rolling_code_sniff_start_ = millis();
+            ESP_LOGI(TAG, "Listening for wall-control traffic for %" PRIu32 " ms before starting",
+                     this->rolling_code_sniff_duration_);
+        }
+#endif
         this->defer([this]() { this->start_if_ready_(); });
-        this->set_timeout("startup_secplus_status_log", 20000, []() {
+        this->start_timer_(HubTimer::STARTUP_STATUS_LOG, STARTUP_STATUS_LOG_MS);
+
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+        this->set_interval("loop_profile_report", this->loop_profile_report_interval_,
+                           [this]() { this->profiler_.report(); });
+#endif
+    }
+
+    void GDOComponent::loop() {
+        this->timers_.poll(millis(), [this](HubTimer timer) { this->on_timer_(timer); });
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        this->poll_monitor_();
+#endif
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        if (this->rolling_code_sniffing_) {
+            this->poll_rolling_code_sniff_();
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        this->drain_priority_events_();
+#endif
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        if (this->obstruction_pin_ != nullptr) {
+            this->poll_obstruction_pin_();
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+        global_gdo_log.drain(DEFERRED_LOG_RECORDS_PER_LOOP);
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        if (this->history_dump_active_) {
+            this->dump_history_batch_();
+            return;
+        }
+#endif
+#if !defined(USE_SECPLUS_GDO_DEFERRED_LOG) && !defined(USE_SECPLUS_GDO_OBSTRUCTION_PIN) && \
+    !defined(USE_SECPLUS_GDO_PRIORITY_EVENTS) && !defined(USE_SECPLUS_GDO_ROLLING_CODE_SNIFF) && \
+    !defined(USE_SECPLUS_GDO_MONITOR_ONLY)
+        // Nothing else needs polling, so loop() only runs while a timer is armed.
+        if (this->timers_.idle()) {
+            this->disable_loop();
+        }
+#endif
+    }
+
+    void GDOComponent::on_timer_(HubTimer timer) {
+        switch (timer) {
+        case HubTimer::STARTUP_STATUS_LOG: {
             gdo_status_t status{};
             const auto err = gdo_get_status(&status);
             if (err != ESP_OK) {
                 ESP_LOGW(TAG, "Failed to read startup Security+ status: %s", esp_err_to_name(err));
-                return;
+                break;
             }
 
             if (status.protocol == GDO_PROTOCOL_SEC_PLUS_V2) {
@@ -457,24 +1374,97 @@ namespace secplus_gdo {
                          status.door != GDO_DOOR_STATE_UNKNOWN ? "received" : "not received",
                          status.synced ? "complete" : "incomplete", status.client_id, status.rolling_code);
             }
-        });
+            break;
+        }
+        case HubTimer::DIAGNOSTIC_DRIVER_RESTART:
+            this->restart_driver_for_diagnostic_sync_();
+            break;
+        case HubTimer::MONITOR_MOTION_CLEAR:
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+            this->status_.motion = GDO_MOTION_STATE_CLEAR;
+            this->emit_monitor_event_(GDO_CB_EVENT_MOTION);
+#endif
+            break;
+        case HubTimer::STATUS_SNAPSHOT:
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+            this->publish_status_snapshot_();
+#endif
+            break;
+        case HubTimer::COUNT:
+            break;
+        }
     }
 
     void GDOComponent::dump_config() {
         ESP_LOGCONFIG(TAG, "secplus GDO:");
         ESP_LOGCONFIG(TAG, "  UART TX pin: %d", GDO_UART_TX_PIN);
         ESP_LOGCONFIG(TAG, "  UART RX pin: %d", GDO_UART_RX_PIN);
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        LOG_PIN("  Obstruction pin: ", this->obstruction_pin_);
+#endif
+        if (this->uart_rx_full_threshold_ != 0) {
+            ESP_LOGCONFIG(TAG, "  UART RX full threshold: %" PRIu8 " bytes", this->uart_rx_full_threshold_);
+        }
+        if (this->uart_rx_timeout_ != 0) {
+            ESP_LOGCONFIG(TAG, "  UART RX timeout: %" PRIu8 " symbols", this->uart_rx_timeout_);
+        }
+        if (this->task_priority_ != 0) {
+            ESP_LOGCONFIG(TAG, "  gdolib task priority: %" PRIu8, this->task_priority_);
+        }
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        ESP_LOGCONFIG(TAG, "  Rolling code sniff: %" PRIu32 " ms", this->rolling_code_sniff_duration_);
+#endif
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        ESP_LOGCONFIG(TAG, "  Mode: monitor only, not transmitting");
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        ESP_LOGCONFIG(TAG, "  History partition: %s (%" PRIu32 " bytes)%s", this->history_partition_,
+                      this->history_.capacity(), this->history_.ready() ? "" : ", not found");
+#endif
         ESP_LOGCONFIG(TAG, "  Initialized: %s", YESNO(this->initialized_));
         ESP_LOGCONFIG(TAG, "  Started: %s", YESNO(this->started_));
+#if SECPLUS_GDO_TRACKS_MOTOR
+        ESP_LOGCONFIG(TAG, "  Trigger attribution window: %" PRIu32 " ms", this->attribution_.get_window());
+#endif
+#ifdef USE_SECPLUS_GDO_COVER
         ESP_LOGCONFIG(TAG, "  Cover registered: %s", YESNO(this->door_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_LIGHT
         ESP_LOGCONFIG(TAG, "  Light registered: %s", YESNO(this->light_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_LOCK
         ESP_LOGCONFIG(TAG, "  Lock registered: %s", YESNO(this->lock_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_SELECT
         ESP_LOGCONFIG(TAG, "  Protocol select registered: %s", YESNO(this->protocol_select_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH_TOGGLE_ONLY
         ESP_LOGCONFIG(TAG, "  Toggle-only switch registered: %s", YESNO(this->toggle_only_switch_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH_LEARN
         ESP_LOGCONFIG(TAG, "  Learn switch registered: %s", YESNO(this->learn_switch_ != nullptr));
+#endif
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        ESP_LOGCONFIG(TAG, "  Priority events: obstruction, door stopped");
+#endif
+#ifdef USE_SECPLUS_GDO_DEFERRED_LOG
+        ESP_LOGCONFIG(TAG, "  Log mode: deferred, %u record ring", static_cast<unsigned>(SECPLUS_GDO_LOG_BUFFER_SIZE));
+#endif
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+        ESP_LOGCONFIG(TAG, "  Loop profile report interval: %" PRIu32 " ms, budget: %" PRIu32 " us",
+                      this->loop_profile_report_interval_, this->profiler_.get_budget_us());
+#endif
     }
 
     void GDOComponent::on_shutdown() {
+#ifdef USE_SECPLUS_GDO_HISTORY
+        this->history_.flush();
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        if (this->door_health_dirty_) {
+            this->save_door_health_();
+        }
+#endif
         if (!this->initialized_) {
             return;
         }
@@ -490,6 +1480,195 @@ namespace secplus_gdo {
         this->started_ = false;
     }
 
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+    void GDOComponent::poll_rolling_code_sniff_() {
+        std::array<uint8_t, 64> buf;
+        int len;
+        while ((len = uart_read_bytes(GDO_UART_NUM, buf.data(), buf.size(), 0)) > 0) {
+            this->rolling_code_sniffer_.feed(buf.data(), static_cast<size_t>(len));
+        }
+
+        if (millis() - this->rolling_code_sniff_start_ >= this->rolling_code_sniff_duration_) {
+            this->finish_rolling_code_sniff_();
+        }
+    }
+
+    void GDOComponent::finish_rolling_code_sniff_() {
+        this->rolling_code_sniffing_ = false;
+        // Leave gdolib a clean receive buffer instead of half a frame.
+        uart_flush_input(GDO_UART_NUM);
+
+        const auto &sniffer = this->rolling_code_sniffer_;
+        if (!sniffer.has_rolling_code()) {
+            ESP_LOGI(TAG, "No Security+ 2.0 frames heard (%" PRIu32 " rejected); starting with rolling code search",
+                     sniffer.rejected());
+        } else {
+            const uint32_t sniffed = sniffer.max_rolling_code() + ROLLING_CODE_SNIFF_MARGIN;
+            if (this->has_last_known_rolling_code_ && this->last_known_rolling_code_ >= sniffed) {
+                ESP_LOGI(TAG, "Heard %" PRIu32 " frames; saved rolling code %" PRIu32 " is already ahead",
+                         sniffer.frames(), this->last_known_rolling_code_);
+            } else {
+                const auto err = gdo_set_rolling_code(sniffed);
+                if (err != ESP_OK) {
+                    ESP_LOGW(TAG, "Failed to set sniffed rolling code: %s", esp_err_to_name(err));
+                } else {
+                    ESP_LOGI(TAG, "Heard %" PRIu32 " frames; starting at rolling code %" PRIu32, sniffer.frames(),
+                             sniffed);
+                    // Not saved until the opener accepts it during sync.
+                    this->remember_rolling_code_(sniffed);
+                }
+            }
+        }
+
+        this->start_if_ready_();
+    }
+#endif
+
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+    static gdo_door_state_t door_state_from_wire(uint8_t nibble) {
+        switch (nibble) {
+        case 1:
+            return GDO_DOOR_STATE_OPEN;
+        case 2:
+            return GDO_DOOR_STATE_CLOSED;
+        case 3:
+            return GDO_DOOR_STATE_STOPPED;
+        case 4:
+            return GDO_DOOR_STATE_OPENING;
+        case 5:
+            return GDO_DOOR_STATE_CLOSING;
+        default:
+            return GDO_DOOR_STATE_UNKNOWN;
+        }
+    }
+
+    esp_err_t GDOComponent::install_monitor_uart_() {
+        const uart_config_t uart_config = {
+            .baud_rate = MONITOR_UART_BAUD,
+            .data_bits = UART_DATA_8_BITS,
+            .parity = UART_PARITY_DISABLE,
+            .stop_bits = UART_STOP_BITS_1,
+            .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+            .rx_flow_ctrl_thresh = 0,
+            .source_clk = UART_SCLK_DEFAULT,
+        };
+        auto err = uart_driver_install(GDO_UART_NUM, MONITOR_UART_RX_BUFFER_SIZE, 0, 0, nullptr, 0);
+        if (err == ESP_OK) {
+            err = uart_param_config(GDO_UART_NUM, &uart_config);
+        }
+        if (err == ESP_OK) {
+            // RX only; the TX pin is left as released by release_uart_tx_pin_to_safe_state_().
+            err = uart_set_pin(GDO_UART_NUM, UART_PIN_NO_CHANGE, GDO_UART_RX_PIN, UART_PIN_NO_CHANGE,
+                               UART_PIN_NO_CHANGE);
+        }
+        if (err == ESP_OK) {
+            err = uart_set_line_inverse(GDO_UART_NUM, UART_SIGNAL_RXD_INV);
+        }
+        return err;
+    }
+
+    void GDOComponent::poll_monitor_() {
+        std::array<uint8_t, 64> buf;
+        WirelinePacket packet;
+        int len;
+        while ((len = uart_read_bytes(GDO_UART_NUM, buf.data(), buf.size(), 0)) > 0) {
+            for (int i = 0; i < len; i++) {
+                if (this->monitor_framer_.feed_byte(buf[i], &packet)) {
+                    this->apply_monitor_packet_(packet);
+                }
+            }
+        }
+    }
+
+    void GDOComponent::emit_monitor_event_(gdo_cb_event_t event) {
+        this->mirror_status(this->status_, event);
+        if (!event_has_consumer(event)) {
+            return;
+        }
+        QueuedStatus status{};
+        static_cast<gdo_status_t &>(status) = this->status_;
+        status.queued_us = micros();
+        status.seq = ++this->event_seq_;
+        process_gdo_event(&status, event, this);
+    }
+
+    // Mirrors what gdolib reports for the same frames, so entities are fed through the usual event path.
+    void GDOComponent::apply_monitor_packet_(const WirelinePacket &packet) {
+        switch (static_cast<WirelineCommand>(packet.command)) {
+        case WirelineCommand::STATUS: {
+            if (!this->status_.synced) {
+                GDO_LOGI(LogSubsystem::COMPONENT, "Monitoring opener status");
+                this->set_sync_state(true);
+            }
+
+            const auto door = door_state_from_wire(packet.nibble);
+            if (door != GDO_DOOR_STATE_UNKNOWN && door != this->status_.door) {
+                this->status_.door = door;
+                if (door == GDO_DOOR_STATE_OPEN) {
+                    this->status_.door_position = 0;
+                } else if (door == GDO_DOOR_STATE_CLOSED) {
+                    this->status_.door_position = 10000;
+                }
+                this->emit_monitor_event_(GDO_CB_EVENT_DOOR_POSITION);
+            }
+
+            const auto light = (packet.byte2 >> 1) & 1 ? GDO_LIGHT_STATE_ON : GDO_LIGHT_STATE_OFF;
+            if (light != this->status_.light) {
+                this->status_.light = light;
+                this->emit_monitor_event_(GDO_CB_EVENT_LIGHT);
+            }
+
+            const auto lock = packet.byte2 & 1 ? GDO_LOCK_STATE_LOCKED : GDO_LOCK_STATE_UNLOCKED;
+            if (lock != this->status_.lock) {
+                this->status_.lock = lock;
+                this->emit_monitor_event_(GDO_CB_EVENT_LOCK);
+            }
+
+            const auto obstruction =
+                (packet.byte1 >> 6) & 1 ? GDO_OBSTRUCTION_STATE_OBSTRUCTED : GDO_OBSTRUCTION_STATE_CLEAR;
+            if (obstruction != this->status_.obstruction) {
+                this->status_.obstruction = obstruction;
+                this->emit_monitor_event_(GDO_CB_EVENT_OBSTRUCTION);
+            }
+
+            const auto learn = (packet.byte2 >> 5) & 1 ? GDO_LEARN_STATE_ACTIVE : GDO_LEARN_STATE_INACTIVE;
+            if (learn != this->status_.learn) {
+                this->status_.learn = learn;
+                this->emit_monitor_event_(GDO_CB_EVENT_LEARN);
+            }
+            break;
+        }
+        case WirelineCommand::DOOR_ACTION:
+            this->status_.button = packet.byte1 & 1 ? GDO_BUTTON_STATE_PRESSED : GDO_BUTTON_STATE_RELEASED;
+            this->emit_monitor_event_(GDO_CB_EVENT_BUTTON);
+            break;
+        case WirelineCommand::MOTOR_ON:
+            this->status_.motor = GDO_MOTOR_STATE_ON;
+            this->emit_monitor_event_(GDO_CB_EVENT_MOTOR);
+            break;
+        case WirelineCommand::MOTION:
+            this->status_.motion = GDO_MOTION_STATE_DETECTED;
+            this->emit_monitor_event_(GDO_CB_EVENT_MOTION);
+            this->start_timer_(HubTimer::MONITOR_MOTION_CLEAR, MONITOR_MOTION_CLEAR_MS);
+            break;
+        case WirelineCommand::OPENINGS: {
+            // A nonzero nibble is a report nobody asked for, and only trusted once a count is known.
+            if (packet.nibble != 0 && this->status_.openings == 0) {
+                break;
+            }
+            const auto openings = static_cast<uint16_t>((packet.byte1 << 8) | packet.byte2);
+            if (openings != this->status_.openings) {
+                this->status_.openings = openings;
+                this->emit_monitor_event_(GDO_CB_EVENT_OPENINGS);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+#endif
+
     void GDOComponent::remember_rolling_code_(uint32_t num) {
         this->last_known_rolling_code_ = num;
         this->rolling_code_search_value_ = num;
@@ -552,11 +1731,11 @@ namespace secplus_gdo {
         }
 
         this->diagnostic_driver_restart_pending_ = true;
-        this->set_timeout("diagnostic_driver_restart", 1000,
-                          [this]() { this->restart_driver_for_diagnostic_sync_(); });
+        this->start_timer_(HubTimer::DIAGNOSTIC_DRIVER_RESTART, DIAGNOSTIC_DRIVER_RESTART_DELAY_MS);
     }
 
     void GDOComponent::restart_driver_for_diagnostic_sync_() {
+        GDO_PROFILE_SCOPE(this->profiler_, ProfileSlot::DRIVER_RESTART);
         this->diagnostic_driver_restart_pending_ = false;
 
         if (!this->initialized_) {
@@ -587,11 +1766,18 @@ namespace secplus_gdo {
                  this->diagnostic_driver_restart_attempt_count_, MAX_DIAGNOSTIC_DRIVER_RESTARTS, client_id,
                  rolling_code);
 
-        const auto deinit_err = gdo_deinit();
+        this->restart_driver_(GDO_PROTOCOL_SEC_PLUS_V2, client_id, rolling_code);
+    }
+
+    bool GDOComponent::restart_driver_(gdo_protocol_type_t protocol, uint32_t client_id, uint32_t rolling_code) {
+        esp_err_t deinit_err;
+        {
+            GDO_PROFILE_SCOPE(this->profiler_, ProfileSlot::GDO_DEINIT);
+            deinit_err = gdo_deinit();
+        }
         if (deinit_err != ESP_OK) {
-            ESP_LOGW(TAG, "Failed to deinitialize secplus GDO for diagnostic sync restart: %s",
-                     esp_err_to_name(deinit_err));
-            return;
+            ESP_LOGW(TAG, "Failed to deinitialize secplus GDO for driver restart: %s", esp_err_to_name(deinit_err));
+            return false;
         }
 
         this->release_uart_tx_pin_to_safe_state_();
@@ -600,41 +1786,99 @@ namespace secplus_gdo {
 
         const auto init_err = this->init_driver_();
         if (init_err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to reinitialize secplus GDO for diagnostic sync restart: %s",
-                     esp_err_to_name(init_err));
+            ESP_LOGE(TAG, "Failed to reinitialize secplus GDO for driver restart: %s", esp_err_to_name(init_err));
             this->release_uart_tx_pin_to_safe_state_();
             this->mark_failed();
-            return;
+            return false;
         }
 
-        const auto protocol_err = gdo_set_protocol(GDO_PROTOCOL_SEC_PLUS_V2);
-        if (protocol_err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to restore Security+ 2.0 protocol after gdolib driver restart: %s",
-                     esp_err_to_name(protocol_err));
-            return;
+        // An unknown protocol is left to gdolib's detection, as on boot.
+        if (protocol != GDO_PROTOCOL_UNKNOWN) {
+            const auto protocol_err = gdo_set_protocol(protocol);
+            if (protocol_err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to restore protocol after gdolib driver restart: %s",
+                         esp_err_to_name(protocol_err));
+                return false;
+            }
         }
 
         const auto client_id_err = gdo_set_client_id(client_id);
         if (client_id_err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to restore Client ID after gdolib driver restart: %s",
                      esp_err_to_name(client_id_err));
-            return;
+            return false;
         }
 
         const auto rolling_code_err = gdo_set_rolling_code(rolling_code);
         if (rolling_code_err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to restore rolling code after gdolib driver restart: %s",
                      esp_err_to_name(rolling_code_err));
-            return;
+            return false;
         }
 
         this->remember_rolling_code_(rolling_code);
         this->sync_toggle_only_();
         this->start_if_ready_();
+        return true;
+    }
+
+    void GDOComponent::reset_door_timings() {
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        ESP_LOGW(TAG, "Ignoring door timing reset in monitor-only mode");
+#else
+#ifdef USE_SECPLUS_GDO_NUMBER_OPEN_DURATION
+        if (this->open_duration_ != nullptr) {
+            this->open_duration_->update_state(0);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION
+        if (this->close_duration_ != nullptr) {
+            this->close_duration_->update_state(0);
+        }
+#endif
+#endif
+    }
+
+    void GDOComponent::resync() {
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        ESP_LOGW(TAG, "Ignoring resync in monitor-only mode");
+#else
+        if (!this->initialized_) {
+            ESP_LOGW(TAG, "Skipping resync because secplus GDO is not initialized");
+            return;
+        }
+
+        gdo_status_t status{};
+        const auto status_err = gdo_get_status(&status);
+        if (status_err != ESP_OK) {
+            ESP_LOGW(TAG, "Skipping resync because status could not be read: %s", esp_err_to_name(status_err));
+            return;
+        }
+        if (status.protocol == GDO_PROTOCOL_SEC_PLUS_V1 || status.protocol == GDO_PROTOCOL_DRY_CONTACT) {
+            ESP_LOGW(TAG, "Skipping resync on protocol %s, which has no client ID",
+                     gdo_protocol_type_to_string(status.protocol));
+            return;
+        }
+
+        // Random upper bits, fixed 0x2908 lower bits, as used by the package's Re-sync button since its first release.
+        const uint32_t client_id = ((random_uint32() & 0x7F7F) << 16) | 0x2908;
+        ESP_LOGW(TAG, "Re-syncing with Client ID: 0x%08" PRIX32 " (%" PRIu32 "), Rolling code: 0", client_id,
+                 client_id);
+
+        this->reset_diagnostic_resync_state();
+        this->set_sync_state(false);
+        if (!this->restart_driver_(status.protocol, client_id, 0)) {
+            return;
+        }
+
+        // Saved once the driver runs with the new identity, so a failed restart keeps the old one on reboot.
+        this->set_client_id(client_id);
+        this->set_rolling_code(0);
+#endif
     }
 
     void GDOComponent::reset_diagnostic_resync_state() {
-        this->cancel_timeout("diagnostic_driver_restart");
+        this->timers_.cancel(HubTimer::DIAGNOSTIC_DRIVER_RESTART);
         this->diagnostic_driver_restart_pending_ = false;
         this->diagnostic_driver_restart_attempt_count_ = 0;
     }
@@ -642,29 +1886,203 @@ namespace secplus_gdo {
     void GDOComponent::set_rolling_code(uint32_t num) {
         this->remember_rolling_code_(num);
 
+#ifdef USE_SECPLUS_GDO_NUMBER_ROLLING_CODE
         if (this->rolling_code_ != nullptr) {
             this->rolling_code_->update_state(num);
         }
+#endif
+    }
+
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_AUTO_CLOSE_TIME
+    void GDOComponent::publish_auto_close_time(uint32_t remaining_ms) {
+        if (this->auto_close_time_sensor_ == nullptr) {
+            return;
+        }
+        // An absolute deadline stays correct while the countdown runs; without wall-clock time there is none.
+        struct timeval now;
+        gettimeofday(&now, nullptr);
+        if (remaining_ms == 0 || now.tv_sec < CLOCK_SET_MIN_TIME) {
+            this->auto_close_time_sensor_->update_state("");
+            return;
+        }
+        const uint64_t deadline_ms = static_cast<uint64_t>(now.tv_sec) * 1000 + now.tv_usec / 1000 + remaining_ms;
+        const time_t seconds = deadline_ms / 1000;
+        struct tm utc;
+        char stamp[32];
+        const size_t len = strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", gmtime_r(&seconds, &utc));
+        snprintf(stamp + len, sizeof(stamp) - len, ".%03u+00:00", static_cast<unsigned>(deadline_ms % 1000));
+        this->auto_close_time_sensor_->update_state(stamp);
+    }
+#endif
+
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+    void GDOComponent::publish_status_snapshot_() {
+        // status() holds the latest report; the effective sync state is only known here.
+        auto snapshot = format_status_snapshot(this->status(), this->status_.synced);
+        if (this->status_snapshot_sensor_ == nullptr || snapshot == this->status_snapshot_) {
+            return;
+        }
+        this->status_snapshot_ = std::move(snapshot);
+        this->status_snapshot_generation_++;
+        this->status_snapshot_sensor_->update_state(
+            with_generation(this->status_snapshot_, this->status_snapshot_generation_));
+    }
+#endif
+
+#ifdef USE_SECPLUS_GDO_HISTORY
+    void GDOComponent::record_history(const gdo_status_t &status, gdo_cb_event_t event) {
+        HistoryKind kind;
+        uint32_t value;
+        switch (event) {
+        case GDO_CB_EVENT_DOOR_POSITION:
+            kind = HistoryKind::DOOR;
+            value = status.door;
+            break;
+        case GDO_CB_EVENT_LIGHT:
+            kind = HistoryKind::LIGHT;
+            value = status.light;
+            break;
+        case GDO_CB_EVENT_LOCK:
+            kind = HistoryKind::LOCK;
+            value = status.lock;
+            break;
+        case GDO_CB_EVENT_OBSTRUCTION:
+            kind = HistoryKind::OBSTRUCTION;
+            value = status.obstruction;
+            break;
+        case GDO_CB_EVENT_MOTION:
+            kind = HistoryKind::MOTION;
+            value = status.motion;
+            break;
+        default:
+            return;
+        }
+        // Stamped with when gdolib reported the change rather than when the main loop got to it.
+        const uint32_t now_ms = millis() - (micros() - this->event_time_us_) / 1000;
+        const auto now = ::time(nullptr);
+        this->history_.record_change(kind, value, now_ms, now > CLOCK_SET_MIN_TIME ? static_cast<uint32_t>(now) : 0);
+    }
+
+    static const char *history_value_to_string(const HistoryEntry &entry) {
+        switch (entry.kind) {
+        case HistoryKind::DOOR:
+            return gdo_door_state_to_string(static_cast<gdo_door_state_t>(entry.value));
+        case HistoryKind::LIGHT:
+            return gdo_light_state_to_string(static_cast<gdo_light_state_t>(entry.value));
+        case HistoryKind::LOCK:
+            return gdo_lock_state_to_string(static_cast<gdo_lock_state_t>(entry.value));
+        case HistoryKind::OBSTRUCTION:
+            return gdo_obstruction_state_to_string(static_cast<gdo_obstruction_state_t>(entry.value));
+        case HistoryKind::MOTION:
+            return gdo_motion_state_to_string(static_cast<gdo_motion_state_t>(entry.value));
+        default:
+            return "unknown";
+        }
+    }
+
+    void GDOComponent::dump_history(const HistoryQuery &query) {
+        if (!this->history_.ready()) {
+            ESP_LOGW(TAG, "History partition '%s' not available", this->history_partition_);
+            return;
+        }
+        if (this->history_dump_active_) {
+            ESP_LOGW(TAG, "History: restarting dump after %u records",
+                     static_cast<unsigned>(this->history_dump_count_));
+        }
+        this->history_dump_query_ = query;
+        this->history_dump_cursor_ = HistoryCursor{};
+        this->history_dump_count_ = 0;
+        this->history_dump_active_ = true;
+        this->enable_loop();
+    }
+
+    void GDOComponent::dump_history_batch_() {
+        static constexpr const char *KIND_NAMES[] = {"time", "door", "light", "lock", "obstruction", "motion"};
+        const bool more = this->history_.walk(
+            this->history_dump_query_, this->history_dump_cursor_, HISTORY_DUMP_RECORDS_PER_LOOP,
+            [this](const HistoryEntry &entry) {
+                this->history_dump_count_++;
+                if (entry.unix_ms == 0) {
+                    ESP_LOGI(TAG, "History: (clock not set) %s: %s", KIND_NAMES[static_cast<uint8_t>(entry.kind)],
+                             history_value_to_string(entry));
+                    return true;
+                }
+                const time_t seconds = entry.unix_ms / 1000;
+                struct tm local;
+                char stamp[24];
+                strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", localtime_r(&seconds, &local));
+                ESP_LOGI(TAG, "History: %s.%03u %s: %s", stamp, static_cast<unsigned>(entry.unix_ms % 1000),
+                         KIND_NAMES[static_cast<uint8_t>(entry.kind)], history_value_to_string(entry));
+                return true;
+            });
+        if (!more) {
+            ESP_LOGI(TAG, "History: %u records", static_cast<unsigned>(this->history_dump_count_));
+            this->history_dump_active_ = false;
+        }
+    }
+#endif
+
+    void GDOComponent::apply_travel_calibration(uint32_t open_ms, uint32_t close_ms) {
+        // gdolib takes 16-bit durations.
+        const auto open = static_cast<uint16_t>(std::min<uint32_t>(open_ms, UINT16_MAX));
+        const auto close = static_cast<uint16_t>(std::min<uint32_t>(close_ms, UINT16_MAX));
+
+        auto err = gdo_set_open_duration(open);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set calibrated open duration: %s", esp_err_to_name(err));
+            return;
+        }
+        err = gdo_set_close_duration(close);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set calibrated close duration: %s", esp_err_to_name(err));
+            return;
+        }
+
+        // Only the numbers: gdolib reports the runs themselves as measurements, which feed the door health stats.
+#ifdef USE_SECPLUS_GDO_NUMBER_OPEN_DURATION
+        if (this->open_duration_ != nullptr) {
+            this->open_duration_->update_state(open);
+        }
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION
+        if (this->close_duration_ != nullptr) {
+            this->close_duration_->update_state(close);
+        }
+#endif
     }
 
     void GDOComponent::set_sync_state(bool synced) {
         this->status_.synced = synced;
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+        this->schedule_status_snapshot();
+#endif
 
+#ifndef USE_SECPLUS_GDO_MONITOR_ONLY
+        // In monitor-only mode the entities never see sync, so they keep refusing commands.
+#ifdef USE_SECPLUS_GDO_COVER
         if (this->door_ != nullptr) {
             this->door_->set_sync_state(synced);
         }
+#endif
 
+#ifdef USE_SECPLUS_GDO_LIGHT
         if (this->light_ != nullptr) {
             this->light_->set_sync_state(synced);
         }
+#endif
 
+#ifdef USE_SECPLUS_GDO_LOCK
         if (this->lock_ != nullptr) {
             this->lock_->set_sync_state(synced);
         }
+#endif
+#endif // USE_SECPLUS_GDO_MONITOR_ONLY
 
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_SYNC
         if (this->sync_sensor_ != nullptr) {
             this->sync_sensor_->publish(synced);
         }
+#endif
     }
 
 } // namespace secplus_gdo
@@ -691,3 +2109,5 @@ void __wrap_esp_panic_handler(void *info) {
 }
 } // extern "C"
 #endif
+
+#endif // USE_SECPLUS_GDO
@@ -18,25 +18,78 @@
 
 #pragma once
 
-#include "binary_sensor/gdo_binary_sensor.h"
-#include "cover/gdo_door.h"
-#include "esphome/core/component.h"
 #include "esphome/core/defines.h"
+
+#ifdef USE_SECPLUS_GDO
+
+#include <atomic>
+
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/preferences.h"
+#include "door_health.h"
+#include "event_history.h"
 #include "gdo.h"
+#include "gdo_event_queue.h"
+#include "gdo_features.h"
+#include "gdo_log.h"
+#include "loop_profiler.h"
+#include "obstruction_input.h"
+#include "paired_inventory.h"
+#include "rolling_code_sniffer.h"
+#include "status_snapshot.h"
+#include "status_mirror.h"
+#include "timer_wheel.h"
+#include "wireline.h"
+#include "trigger_attribution.h"
+
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR
+#include "binary_sensor/gdo_binary_sensor.h"
+#endif
+#ifdef USE_SECPLUS_GDO_COVER
+#include "cover/gdo_door.h"
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT
+#include "event/gdo_event.h"
+#endif
+#ifdef USE_SECPLUS_GDO_LIGHT
 #include "light/gdo_light.h"
+#endif
+#ifdef USE_SECPLUS_GDO_LOCK
 #include "lock/gdo_lock.h"
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER
 #include "number/gdo_number.h"
+#endif
+#ifdef USE_SECPLUS_GDO_SELECT
 #include "select/gdo_select.h"
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR
 #include "sensor/gdo_sensor.h"
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH
 #include "switch/gdo_switch.h"
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR
 #include "text_sensor/gdo_text_sensor.h"
+#endif
 
 namespace esphome {
 namespace secplus_gdo {
 
+    // One-shot timers of the hub, serviced from its loop().
+    enum class HubTimer : uint8_t {
+        STARTUP_STATUS_LOG,
+        DIAGNOSTIC_DRIVER_RESTART,
+        MONITOR_MOTION_CLEAR,
+        STATUS_SNAPSHOT,
+        COUNT,
+    };
+
     class GDOComponent : public Component {
     public:
         void setup() override;
+        void loop() override;
         void dump_config() override;
         void on_shutdown() override;
         void start_gdo();
@@ -45,121 +98,453 @@ namespace secplus_gdo {
         // Initialize the driver early, then defer gdo_start() until child entities have restored preferences.
         [[nodiscard]] float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
+#ifdef USE_SECPLUS_GDO_SELECT
         void register_protocol_select(GDOSelect *select) { this->protocol_select_ = select; }
-        void set_protocol_state(gdo_protocol_type_t protocol) {
+#endif
+        void set_protocol_state([[maybe_unused]] gdo_protocol_type_t protocol) {
+#ifdef USE_SECPLUS_GDO_SELECT
             if (this->protocol_select_ != nullptr) {
                 this->protocol_select_->update_state(protocol);
             }
+#endif
         }
 
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR
         void register_binary_sensor(GDOBinarySensor *sensor);
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR
         void register_sensor(GDOStat *sensor);
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR
         void register_text_sensor(GDOTextSensor *sensor);
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT
+        void register_event(GDOEvent *event);
+#endif
+        // micros() time gdolib reported the event being dispatched; event entities are stamped with it.
+        void set_event_time(uint32_t us) { this->event_time_us_ = us; }
+        uint32_t event_time_us() const { return this->event_time_us_; }
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+        // Publishes the status snapshot once the current burst of events is over.
+        void schedule_status_snapshot() { this->start_timer_(HubTimer::STATUS_SNAPSHOT, STATUS_SNAPSHOT_COALESCE_MS); }
+        // Changes whenever the published snapshot does.
+        uint32_t status_snapshot_generation() const { return this->status_snapshot_generation_; }
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        void set_history(const char *partition, uint32_t flush_interval_ms) {
+            this->history_partition_ = partition;
+            this->history_flush_interval_ = flush_interval_ms;
+        }
+        // Adds the state an event changed to the on-device history.
+        void record_history(const gdo_status_t &status, gdo_cb_event_t event);
+        // Starts logging matching history records, oldest first, a few per loop() iteration.
+        // A dump requested while another runs replaces it.
+        void dump_history(const HistoryQuery &query);
+        EventHistory &history() { return this->history_; }
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER
         void register_number(GDONumber *num);
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH
         void register_switch(GDOSwitch *sw);
+#endif
 
-        void notify_cover_command() { this->cover_triggered_ = true; }
+#if SECPLUS_GDO_TRACKS_MOTOR
+        void set_trigger_attribution_window(uint32_t ms) { this->attribution_.set_window(ms); }
+        void notify_cover_command() { this->attribution_.record(TriggerSource::COVER_COMMAND, millis()); }
+        void notify_light_command() { this->attribution_.record(TriggerSource::LIGHT_COMMAND, millis()); }
+        void notify_lock_command() { this->attribution_.record(TriggerSource::LOCK_COMMAND, millis()); }
+#else
+        void set_trigger_attribution_window([[maybe_unused]] uint32_t ms) {}
+        void notify_cover_command() {}
+        void notify_light_command() {}
+        void notify_lock_command() {}
+#endif
 
+#if SECPLUS_GDO_TRACKS_MOTION
         void set_motion_state(gdo_motion_state_t state);
+#endif
+#if SECPLUS_GDO_TRACKS_OBSTRUCTION
         void set_obstruction(gdo_obstruction_state_t state);
+#endif
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        void set_obstruction_pin(InternalGPIOPin *pin) { this->obstruction_pin_ = pin; }
+#endif
+        // Zero keeps the value gdolib chose.
+        void set_uart_rx_full_threshold(uint8_t bytes) { this->uart_rx_full_threshold_ = bytes; }
+        void set_uart_rx_timeout(uint8_t symbols) { this->uart_rx_timeout_ = symbols; }
+        void set_task_priority(uint8_t priority) { this->task_priority_ = priority; }
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        void set_rolling_code_sniff_duration(uint32_t ms) { this->rolling_code_sniff_duration_ = ms; }
+#endif
+        // Runs in the gdolib task, which is the only place its task handle is known.
+        void apply_task_priority();
+#if SECPLUS_GDO_TRACKS_BUTTON
         void set_button_state(gdo_button_state_t state);
+#endif
+#if SECPLUS_GDO_TRACKS_MOTOR
         void set_motor_state(gdo_motor_state_t state);
+#endif
+#if SECPLUS_GDO_TRACKS_BATTERY
         void set_battery_state(gdo_battery_state_t state);
+#endif
+#if SECPLUS_GDO_TRACKS_OPENINGS
         void set_openings(uint16_t openings);
+#endif
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
         void set_paired_devices(const gdo_paired_device_t &paired_devices);
+#endif
+        // Clears paired devices through gdolib; the counts change only when the opener next reports them.
+        esp_err_t clear_paired_devices(gdo_paired_device_type_t type);
 
+#ifdef USE_SECPLUS_GDO_COVER
         void register_door(GDODoor *door) {
             this->door_ = door;
             if (door != nullptr) {
                 door->set_parent(this);
             }
         }
-        void set_door_state(gdo_door_state_t state, float position) {
+#endif
+        void set_door_state([[maybe_unused]] gdo_door_state_t state, [[maybe_unused]] float position) {
+#ifdef USE_SECPLUS_GDO_COVER
             if (this->door_ != nullptr) {
                 this->door_->set_state(state, position);
             }
+#endif
         }
 
-        void register_light(GDOLight *light) { this->light_ = light; }
+#ifdef USE_SECPLUS_GDO_LIGHT
+        void register_light(GDOLight *light) {
+            this->light_ = light;
+            if (light != nullptr) {
+                light->set_command_callback([this]() { this->notify_light_command(); });
+                light->set_outcome_callback(
+                    [this](bool confirmed, uint32_t ms) { this->record_command_outcome_(confirmed, ms); });
+            }
+        }
         void set_light_state(gdo_light_state_t state) {
             if (this->light_ != nullptr) {
                 this->light_->set_state(state);
             }
         }
+#endif
 
-        void register_lock(GDOLock *lock) { this->lock_ = lock; }
+#ifdef USE_SECPLUS_GDO_LOCK
+        void register_lock(GDOLock *lock) {
+            this->lock_ = lock;
+            if (lock != nullptr) {
+                lock->set_command_callback([this]() { this->notify_lock_command(); });
+                lock->set_outcome_callback(
+                    [this](bool confirmed, uint32_t ms) { this->record_command_outcome_(confirmed, ms); });
+            }
+        }
         void set_lock_state(gdo_lock_state_t state) {
             if (this->lock_ != nullptr) {
                 this->lock_->set_state(state);
             }
         }
+#endif
 
-        void set_learn_state(gdo_learn_state_t state) {
-            if (this->learn_switch_ != nullptr) {
-                this->learn_switch_->publish_state_from_device(state == GDO_LEARN_STATE_ACTIVE);
-            }
-        }
+#if SECPLUS_GDO_TRACKS_LEARN
+        void set_learn_state(gdo_learn_state_t state);
+#endif
 
-        void set_open_duration(uint16_t ms) {
-            if (this->open_duration_ != nullptr) {
-                this->open_duration_->update_state(ms);
+#if SECPLUS_GDO_TRACKS_OPEN_DURATION
+        void set_open_duration(uint16_t ms);
+#endif
+#if SECPLUS_GDO_TRACKS_CLOSE_DURATION
+        void set_close_duration(uint16_t ms);
+#endif
+        void set_client_id([[maybe_unused]] uint32_t num) {
+#ifdef USE_SECPLUS_GDO_NUMBER_CLIENT_ID
+            if (this->client_id_ != nullptr) {
+                this->client_id_->update_state(num);
             }
+#endif
         }
-        void set_close_duration(uint16_t ms) {
-            if (this->close_duration_ != nullptr) {
-                this->close_duration_->update_state(ms);
+        void set_rolling_code(uint32_t num);
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_AUTO_CLOSE_TIME
+        // Publishes when the auto-close countdown ends as an ISO-8601 UTC timestamp; 0 clears it.
+        void publish_auto_close_time(uint32_t remaining_ms);
+#else
+        void publish_auto_close_time([[maybe_unused]] uint32_t remaining_ms) {}
+#endif
+        void publish_reversal_time([[maybe_unused]] uint32_t ms) {
+#ifdef USE_SECPLUS_GDO_SENSOR_REVERSAL_TIME
+            if (this->reversal_time_sensor_ != nullptr) {
+                this->reversal_time_sensor_->update_state(ms);
             }
+#endif
         }
-        void set_client_id(uint32_t num) {
-            if (this->client_id_ != nullptr) {
-                this->client_id_->update_state(num);
+        // Sends travel times measured by a cover calibration run to gdolib and the duration numbers.
+        void apply_travel_calibration(uint32_t open_ms, uint32_t close_ms);
+#ifdef USE_SECPLUS_GDO_SENSOR_CALIBRATION_PROGRESS
+        void publish_calibration_progress(float percent) {
+            if (this->calibration_progress_sensor_ != nullptr) {
+                this->calibration_progress_sensor_->publish_state(percent);
             }
         }
-        void set_rolling_code(uint32_t num);
+#else
+        void publish_calibration_progress([[maybe_unused]] float percent) {}
+#endif
+        // Starts over with a new client ID and rolling code 0 by restarting only the gdolib driver.
+        void resync();
+        // Zeroes the saved open and close durations so gdolib measures them again after the next start.
+        void reset_door_timings();
+
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        // Returns false for an event that a later priority event of the same kind has already superseded.
+        bool accept_event_seq(gdo_cb_event_t event, uint32_t seq);
+#endif
+
+        // Latest opener status as reported with the last event, readable from any task without going through gdolib.
+        gdo_status_t status() const { return this->status_mirror_.load(); }
+        // Changes whenever an event of this kind updates status(); save it and compare to skip unchanged reads.
+        uint32_t status_generation(gdo_cb_event_t event) const { return this->status_mirror_.generation(event); }
+        void mirror_status(const gdo_status_t &status, gdo_cb_event_t event) {
+            this->status_mirror_.store(status, event);
+        }
 
         bool is_sync_state() const { return this->status_.synced; }
         uint32_t next_rolling_code_search_value(uint32_t fallback, bool *advanced = nullptr);
         void schedule_diagnostic_data_resync();
         void reset_diagnostic_resync_state();
         void set_sync_state(bool synced);
+        void set_log_level(LogSubsystem subsystem, uint8_t level) { global_gdo_log.set_level(subsystem, level); }
+
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+        void set_loop_profile_report_interval(uint32_t ms) { this->loop_profile_report_interval_ = ms; }
+        void set_loop_profile_budget(uint32_t us) { this->profiler_.set_budget_us(us); }
+        LoopProfiler &profiler() { return this->profiler_; }
+#endif
 
     protected:
+        void start_timer_(HubTimer timer, uint32_t delay_ms) {
+            this->timers_.arm(timer, millis(), delay_ms);
+            this->enable_loop();
+        }
+        void on_timer_(HubTimer timer);
         esp_err_t init_driver_();
         void remember_rolling_code_(uint32_t num);
         void release_uart_tx_pin_to_safe_state_();
         void schedule_diagnostic_driver_restart_();
         void restart_driver_for_diagnostic_sync_();
+        bool restart_driver_(gdo_protocol_type_t protocol, uint32_t client_id, uint32_t rolling_code);
         void sync_toggle_only_();
         void start_if_ready_();
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        void drain_priority_events_();
+#endif
+#if SECPLUS_GDO_TRACKS_MOTOR
+        void publish_trigger_source_(TriggerSource source, const uint32_t *latency_ms);
+#endif
+#if SECPLUS_GDO_TRACKS_OBSTRUCTION
+        void publish_obstruction_(bool obstructed, uint32_t at_us);
+#endif
+#if defined(USE_SECPLUS_GDO_LIGHT) || defined(USE_SECPLUS_GDO_LOCK)
+        void record_command_outcome_(bool confirmed, uint32_t latency_ms);
+#endif
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
+        void load_paired_inventory_();
+        void publish_paired_inventory_(uint8_t changed);
+#endif
+#if SECPLUS_GDO_TRACKS_STATUS_SNAPSHOT
+        void publish_status_snapshot_();
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        void load_door_health_();
+        void record_travel_(DoorHealth::Direction direction, uint16_t ms);
+        void door_health_changed_();
+        void update_door_health_();
+        void save_door_health_();
+        void publish_door_health_();
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        void dump_history_batch_();
+#endif
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        void poll_obstruction_pin_();
+        void compare_obstruction_paths_(ObstructionPathCompare::Path path, bool obstructed, uint32_t at_ms);
+#endif
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        void poll_rolling_code_sniff_();
+        void finish_rolling_code_sniff_();
+#endif
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        esp_err_t install_monitor_uart_();
+        void poll_monitor_();
+        void apply_monitor_packet_(const WirelinePacket &packet);
+        void emit_monitor_event_(gdo_cb_event_t event);
+#endif
 
         gdo_status_t      status_{};
+        uint32_t          event_seq_{0}; // written by the gdolib task only
+        StatusMirror      status_mirror_{};
+        uint32_t          event_time_us_{0};
+#ifdef USE_SECPLUS_GDO_PRIORITY_EVENTS
+        PriorityEventQueue<PRIORITY_EVENT_QUEUE_SIZE> priority_events_{};
+        std::array<uint32_t, 2> last_event_seq_{};
+#endif
+#if SECPLUS_GDO_TRACKS_MOTOR
+        TriggerAttribution attribution_{};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTION
         GDOBinarySensor  *motion_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_OBSTRUCTION
         GDOBinarySensor  *obstruction_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_MOTOR
         GDOBinarySensor  *motor_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_BUTTON
         GDOBinarySensor  *button_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_SYNC
         GDOBinarySensor  *sync_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_WIRELESS_REMOTE
         GDOBinarySensor  *wireless_remote_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_COVER
         GDODoor          *door_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_LIGHT
         GDOLight         *light_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_LOCK
         GDOLock          *lock_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_BATTERY
         GDOTextSensor    *battery_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_BUTTON
+        GDOEvent         *button_event_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_WIRELESS_REMOTE
+        GDOEvent         *wireless_remote_event_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_MOTION
+        GDOEvent         *motion_event_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_EVENT_OBSTRUCTION
+        GDOEvent         *obstruction_event_{nullptr};
+        // Last state fired, so the pin and the status reporting the same change fire once.
+        gdo_obstruction_state_t obstruction_event_state_{GDO_OBSTRUCTION_STATE_MAX};
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_LAST_TRIGGER_SOURCE
+        GDOTextSensor    *trigger_source_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_STATUS_SNAPSHOT
+        GDOTextSensor    *status_snapshot_sensor_{nullptr};
+        std::string       status_snapshot_{};
+        uint32_t          status_snapshot_generation_{0};
+#endif
+#ifdef USE_SECPLUS_GDO_TEXT_SENSOR_AUTO_CLOSE_TIME
+        GDOTextSensor    *auto_close_time_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPENINGS
         GDOStat          *openings_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_TRIGGER_LATENCY
+        GDOStat          *trigger_latency_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_PIN_LEAD
+        GDOStat          *obstruction_pin_lead_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CALIBRATION_PROGRESS
+        GDOStat          *calibration_progress_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_COMMAND_LATENCY
+        GDOStat          *command_latency_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_UNACKNOWLEDGED_COMMANDS
+        GDOStat          *unacknowledged_commands_sensor_{nullptr};
+#endif
+#if defined(USE_SECPLUS_GDO_LIGHT) || defined(USE_SECPLUS_GDO_LOCK)
+        uint32_t          unacknowledged_commands_{0};
+#endif
+#if SECPLUS_GDO_TRACKS_PAIRED_DEVICES
+        PairedInventory     paired_inventory_{};
+        ESPPreferenceObject paired_inventory_pref_;
+#endif
+#if SECPLUS_GDO_TRACKS_DOOR_HEALTH
+        DoorHealth          door_health_{};
+        ESPPreferenceObject door_health_pref_;
+        bool                health_obstructed_{false};
+        bool                door_health_dirty_{false};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_AVERAGE
+        GDOStat          *open_time_average_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_AVERAGE
+        GDOStat          *close_time_average_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OPEN_TIME_P90
+        GDOStat          *open_time_p90_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CLOSE_TIME_P90
+        GDOStat          *close_time_p90_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_CYCLES_PER_DAY
+        GDOStat          *cycles_per_day_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_OBSTRUCTION_RATE
+        GDOStat          *obstruction_rate_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_REVERSAL_TIME
+        GDOStat          *reversal_time_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_BINARY_SENSOR_TRAVEL_DRIFT
+        GDOBinarySensor  *travel_drift_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_TOTAL
         GDOStat          *paired_total_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_REMOTES
         GDOStat          *paired_remotes_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_KEYPADS
         GDOStat          *paired_keypads_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_WALL_CONTROLS
         GDOStat          *paired_wall_controls_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SENSOR_PAIRED_DEVICES_ACCESSORIES
         GDOStat          *paired_accessories_sensor_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_OPEN_DURATION
         GDONumber        *open_duration_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLOSE_DURATION
         GDONumber        *close_duration_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_CLIENT_ID
         GDONumber        *client_id_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_NUMBER_ROLLING_CODE
         GDONumber        *rolling_code_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SELECT
         GDOSelect        *protocol_select_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH_LEARN
         GDOSwitch        *learn_switch_{nullptr};
+#endif
+#ifdef USE_SECPLUS_GDO_SWITCH_TOGGLE_ONLY
         GDOSwitch        *toggle_only_switch_{nullptr};
+#endif
         bool              initialized_{false};
         bool              started_{false};
-        bool              cover_triggered_{false};
-        bool              button_triggered_{false};
+        uint8_t           uart_rx_full_threshold_{0};
+        uint8_t           uart_rx_timeout_{0};
+        uint8_t           task_priority_{0};
+        std::atomic<bool> task_priority_applied_{false}; // set by the gdolib task, cleared by the main loop
+#if SECPLUS_GDO_TRACKS_MOTOR
+        bool              motor_running_{false};
+        bool              wireless_remote_active_{false};
+#endif
+        TimerWheel<HubTimer> timers_{};
         bool              has_last_known_rolling_code_{false};
         bool              has_rolling_code_search_value_{false};
         bool              diagnostic_driver_restart_pending_{false};
@@ -167,8 +552,37 @@ namespace secplus_gdo {
         uint8_t           rolling_code_anchor_retries_remaining_{0};
         uint32_t          last_known_rolling_code_{0};
         uint32_t          rolling_code_search_value_{0};
+#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN
+        InternalGPIOPin  *obstruction_pin_{nullptr};
+        ObstructionInput  obstruction_input_{};
+        ObstructionPathCompare obstruction_compare_{};
+#endif
+#ifdef USE_SECPLUS_GDO_ROLLING_CODE_SNIFF
+        RollingCodeSniffer rolling_code_sniffer_{};
+        uint32_t          rolling_code_sniff_duration_{0};
+        uint32_t          rolling_code_sniff_start_{0};
+        bool              rolling_code_sniffing_{false};
+#endif
+#ifdef USE_SECPLUS_GDO_MONITOR_ONLY
+        WirelineFramer    monitor_framer_{};
+#endif
+#ifdef USE_SECPLUS_GDO_HISTORY
+        EventHistory      history_{};
+        const char       *history_partition_{nullptr};
+        uint32_t          history_flush_interval_{60000};
+        HistoryQuery      history_dump_query_{};
+        HistoryCursor     history_dump_cursor_{};
+        uint32_t          history_dump_count_{0};
+        bool              history_dump_active_{false};
+#endif
+#ifdef USE_SECPLUS_GDO_LOOP_PROFILE
+        LoopProfiler      profiler_{};
+        uint32_t          loop_profile_report_interval_{60000};
+#endif
 
     }; // GDOComponent
 
 } // namespace secplus_gdo
 } // namespace esphome
+
+#endif // USE_SECPLUS_GDO
@@ -3,7 +3,14 @@ import esphome.config_validation as cv
 from esphome.components import select
 from esphome.const import CONF_INITIAL_OPTION
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO,
+    add_feature_define,
+    is_monitor_only,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -24,8 +31,12 @@ CONFIG_SCHEMA = cv.All(
 
 
 async def to_code(config):
+    if is_monitor_only(config[CONF_SECPLUS_GDO_ID]):
+        # Changing the protocol reconfigures gdolib, which monitor_only never starts.
+        return
     select_var = await select.new_select(config, options=CONF_PROTOCOL_SELECT_OPTIONS)
     await cg.register_component(select_var, config)
     cg.add(select_var.set_initial_option(config[CONF_INITIAL_OPTION]))
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("select")
     cg.add(parent.register_protocol_select(select_var))
@@ -22,7 +22,13 @@ import esphome.config_validation as cv
 from esphome.components import sensor
 from esphome.const import CONF_ID
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -36,6 +42,18 @@ TYPES = {
     "paired_devices_keypads": 3,
     "paired_devices_wall_controls": 4,
     "paired_devices_accessories": 5,
+    "trigger_latency": 6,
+    "obstruction_pin_lead": 7,
+    "calibration_progress": 8,
+    "command_latency": 9,
+    "unacknowledged_commands": 10,
+    "open_time_average": 11,
+    "close_time_average": 12,
+    "open_time_p90": 13,
+    "close_time_p90": 14,
+    "cycles_per_day": 15,
+    "obstruction_rate": 16,
+    "reversal_time": 17,
 }
 
 CONFIG_SCHEMA = cv.All(
@@ -55,5 +73,6 @@ async def to_code(config):
     await sensor.register_sensor(var, config)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("sensor", config[CONF_TYPE])
     cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
     cg.add(parent.register_sensor(var))
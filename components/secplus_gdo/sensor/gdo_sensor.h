@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstdint>
 
 #include "esphome/components/sensor/sensor.h"
@@ -34,6 +35,18 @@ enum class GDOStatType : uint8_t {
     PAIRED_DEVICES_KEYPADS,
     PAIRED_DEVICES_WALL_CONTROLS,
     PAIRED_DEVICES_ACCESSORIES,
+    TRIGGER_LATENCY,
+    OBSTRUCTION_PIN_LEAD,
+    CALIBRATION_PROGRESS,
+    COMMAND_LATENCY,
+    UNACKNOWLEDGED_COMMANDS,
+    OPEN_TIME_AVERAGE,
+    CLOSE_TIME_AVERAGE,
+    OPEN_TIME_P90,
+    CLOSE_TIME_P90,
+    CYCLES_PER_DAY,
+    OBSTRUCTION_RATE,
+    REVERSAL_TIME,
 };
 
 class GDOStat : public sensor::Sensor, public Component {
@@ -42,6 +55,7 @@ public:
     void set_type(uint8_t type) { this->type_ = static_cast<GDOStatType>(type); }
     GDOStatType get_type() const { return this->type_; }
     void update_state(uint32_t value) { this->publish_state(value); }
+    void publish_unknown() { this->publish_state(NAN); }
 
 protected:
     const char *type_to_string_() const {
@@ -58,6 +72,30 @@ protected:
             return "paired_devices_wall_controls";
         case GDOStatType::PAIRED_DEVICES_ACCESSORIES:
             return "paired_devices_accessories";
+        case GDOStatType::TRIGGER_LATENCY:
+            return "trigger_latency";
+        case GDOStatType::OBSTRUCTION_PIN_LEAD:
+            return "obstruction_pin_lead";
+        case GDOStatType::CALIBRATION_PROGRESS:
+            return "calibration_progress";
+        case GDOStatType::COMMAND_LATENCY:
+            return "command_latency";
+        case GDOStatType::UNACKNOWLEDGED_COMMANDS:
+            return "unacknowledged_commands";
+        case GDOStatType::OPEN_TIME_AVERAGE:
+            return "open_time_average";
+        case GDOStatType::CLOSE_TIME_AVERAGE:
+            return "close_time_average";
+        case GDOStatType::OPEN_TIME_P90:
+            return "open_time_p90";
+        case GDOStatType::CLOSE_TIME_P90:
+            return "close_time_p90";
+        case GDOStatType::CYCLES_PER_DAY:
+            return "cycles_per_day";
+        case GDOStatType::OBSTRUCTION_RATE:
+            return "obstruction_rate";
+        case GDOStatType::REVERSAL_TIME:
+            return "reversal_time";
         default:
             return "unknown";
         }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "gdo.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Copy of the latest gdolib status, written once per event by a single writer (the gdolib task, or the main
+// loop in monitor-only mode) and readable from any task without locks. Readers retry while a write is in
+// progress. Not for use from interrupts, which could spin against a write they preempted.
+class StatusMirror {
+public:
+    void store(const gdo_status_t &status, gdo_cb_event_t event) {
+        const uint32_t seq = this->seq_.load(std::memory_order_relaxed);
+        this->seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        this->status_ = status;
+
+        this->seq_.store(seq + 2, std::memory_order_release);
+        if (event < GDO_CB_EVENT_MAX) {
+            this->generations_[event].fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    gdo_status_t load() const {
+        gdo_status_t status;
+        uint32_t before;
+        do {
+            before = this->seq_.load(std::memory_order_acquire);
+            status = this->status_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((before & 1) != 0 || before != this->seq_.load(std::memory_order_relaxed));
+        return status;
+    }
+
+    // Bumped after each event of this kind lands in the mirror; compare with a saved value to detect changes.
+    uint32_t generation(gdo_cb_event_t event) const {
+        return event < GDO_CB_EVENT_MAX ? this->generations_[event].load(std::memory_order_acquire) : 0;
+    }
+
+protected:
+    gdo_status_t                                        status_{};
+    std::atomic<uint32_t>                               seq_{0};
+    std::array<std::atomic<uint32_t>, GDO_CB_EVENT_MAX> generations_{};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "gdo.h"
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Home Assistant drops text sensor states longer than this.
+constexpr size_t STATUS_SNAPSHOT_MAX_LENGTH = 255;
+// Snapshots are built once events stop arriving for this long, so a burst publishes once.
+constexpr uint32_t STATUS_SNAPSHOT_COALESCE_MS = 50;
+
+// The whole opener status as one compact JSON object, with gdolib enum values as numbers and short keys
+// (listed in the README) to stay under STATUS_SNAPSHOT_MAX_LENGTH. The generation is left out so an
+// unchanged status formats the same; with_generation() adds it in front.
+inline std::string format_status_snapshot(const gdo_status_t &status, bool synced) {
+    char position[8] = "null";
+    if (status.door_position >= 0 && status.door_position <= 10000) {
+        // gdolib counts 0 as fully open; the cover reports percent open.
+        snprintf(position, sizeof(position), "%" PRId32, (10000 - status.door_position) / 100);
+    }
+    const auto &paired = status.paired_devices;
+    char buf[STATUS_SNAPSHOT_MAX_LENGTH + 1];
+    snprintf(buf, sizeof(buf),
+             "\"s\":%d,\"p\":%d,\"d\":%d,\"dp\":%s,\"l\":%d,\"k\":%d,\"o\":%d,\"m\":%d,\"mt\":%d,\"b\":%d,\"bt\":%d,"
+             "\"ln\":%d,\"n\":%u,\"pd\":[%u,%u,%u,%u,%u],\"om\":%u,\"cm\":%u,\"tc\":%u,\"to\":%d,\"cid\":%" PRIu32
+             ",\"rc\":%" PRIu32 "}",
+             synced ? 1 : 0, static_cast<int>(status.protocol), static_cast<int>(status.door), position,
+             static_cast<int>(status.light), static_cast<int>(status.lock), static_cast<int>(status.obstruction),
+             static_cast<int>(status.motion), static_cast<int>(status.motor), static_cast<int>(status.button),
+             static_cast<int>(status.battery), static_cast<int>(status.learn), status.openings, paired.total_all,
+             paired.total_remotes, paired.total_keypads, paired.total_wall_controls, paired.total_accessories,
+             status.open_ms, status.close_ms, status.ttc_seconds, status.toggle_only ? 1 : 0, status.client_id,
+             status.rolling_code);
+    return buf;
+}
+
+inline std::string with_generation(const std::string &snapshot, uint32_t generation) {
+    char prefix[20];
+    snprintf(prefix, sizeof(prefix), "{\"g\":%" PRIu32 ",", generation);
+    return prefix + snapshot;
+}
+
+} // namespace secplus_gdo
+} // namespace esphome
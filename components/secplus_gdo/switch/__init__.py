@@ -3,7 +3,14 @@ import esphome.config_validation as cv
 from esphome.components import switch
 from esphome.const import CONF_ID
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    is_monitor_only,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -28,9 +35,13 @@ CONFIG_SCHEMA = cv.All(
 
 
 async def to_code(config):
+    if is_monitor_only(config[CONF_SECPLUS_GDO_ID]):
+        # Every switch here commands gdolib, which monitor_only never starts.
+        return
     var = cg.new_Pvariable(config[CONF_ID])
     await switch.register_switch(var, config)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("switch", config[CONF_TYPE])
     cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
     cg.add(parent.register_switch(var))
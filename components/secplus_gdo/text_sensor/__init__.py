@@ -22,7 +22,13 @@ import esphome.config_validation as cv
 from esphome.components import text_sensor
 from esphome.const import CONF_ID
 
-from .. import CONF_SECPLUS_GDO_ID, SECPLUS_GDO_CONFIG_SCHEMA, secplus_gdo_ns, validate_cpp_symbol_id
+from .. import (
+    CONF_SECPLUS_GDO_ID,
+    SECPLUS_GDO_CONFIG_SCHEMA,
+    add_feature_define,
+    secplus_gdo_ns,
+    validate_cpp_symbol_id,
+)
 
 DEPENDENCIES = ["secplus_gdo"]
 
@@ -31,6 +37,9 @@ GDOTextSensor = secplus_gdo_ns.class_("GDOTextSensor", text_sensor.TextSensor, c
 CONF_TYPE = "type"
 TYPES = {
     "battery": 0,
+    "last_trigger_source": 1,
+    "status_snapshot": 2,
+    "auto_close_time": 3,
 }
 
 CONFIG_SCHEMA = cv.All(
@@ -50,5 +59,6 @@ async def to_code(config):
     await text_sensor.register_text_sensor(var, config)
     await cg.register_component(var, config)
     parent = await cg.get_variable(config[CONF_SECPLUS_GDO_ID])
+    add_feature_define("text_sensor", config[CONF_TYPE])
     cg.add(var.set_type(TYPES[config[CONF_TYPE]]))
     cg.add(parent.register_text_sensor(var))
@@ -30,6 +30,9 @@ namespace secplus_gdo {
 
 enum class GDOTextSensorType : uint8_t {
     BATTERY = 0,
+    LAST_TRIGGER_SOURCE,
+    STATUS_SNAPSHOT,
+    AUTO_CLOSE_TIME,
 };
 
 class GDOTextSensor : public text_sensor::TextSensor, public Component {
@@ -44,6 +47,12 @@ protected:
         switch (this->type_) {
         case GDOTextSensorType::BATTERY:
             return "battery";
+        case GDOTextSensorType::LAST_TRIGGER_SOURCE:
+            return "last_trigger_source";
+        case GDOTextSensorType::STATUS_SNAPSHOT:
+            return "status_snapshot";
+        case GDOTextSensorType::AUTO_CLOSE_TIME:
+            return "auto_close_time";
         default:
             return "unknown";
         }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace secplus_gdo {
+
+// One-shot timers in fixed slots named by an enum with a trailing COUNT, kept in a hashed timing wheel:
+// arming, re-arming and cancelling a slot are O(1) and never allocate, and each poll only looks at the
+// buckets for the ticks that passed. The owner polls it from loop() with the current time and handles the
+// fired slots in a switch, so it also runs on the host with a virtual clock.
+template<typename Slot, size_t BUCKETS = 32, uint32_t TICK_MS = 16> class TimerWheel {
+public:
+    static constexpr size_t SLOTS = static_cast<size_t>(Slot::COUNT);
+    static_assert(SLOTS <= 32, "fired slots are collected in a 32-bit mask");
+
+    // (Re)starts slot to fire once delay_ms from now_ms has passed. A slot that was already armed is moved.
+    void arm(Slot slot, uint32_t now_ms, uint32_t delay_ms) {
+        const auto index = static_cast<uint8_t>(slot);
+        this->cancel(slot);
+        if (this->armed_count_ == 0) {
+            // Nothing depends on the old clock, so catch up without walking the buckets.
+            this->last_poll_ms_ = now_ms;
+        }
+        // Counted from the last poll, which the current tick stands for, and rounded up so it never fires early.
+        const uint32_t ticks = (now_ms - this->last_poll_ms_ + delay_ms + TICK_MS - 1) / TICK_MS;
+        auto &entry = this->entries_[index];
+        entry.deadline = this->tick_ + std::max<uint32_t>(ticks, 1);
+        entry.armed = true;
+        const auto bucket = entry.deadline % BUCKETS;
+        entry.prev = NONE;
+        entry.next = this->heads_[bucket];
+        if (entry.next != NONE) {
+            this->entries_[entry.next].prev = index;
+        }
+        this->heads_[bucket] = index;
+        this->armed_count_++;
+    }
+
+    void cancel(Slot slot) {
+        const auto index = static_cast<uint8_t>(slot);
+        auto &entry = this->entries_[index];
+        if (!entry.armed) {
+            return;
+        }
+        if (entry.prev != NONE) {
+            this->entries_[entry.prev].next = entry.next;
+        } else {
+            this->heads_[entry.deadline % BUCKETS] = entry.next;
+        }
+        if (entry.next != NONE) {
+            this->entries_[entry.next].prev = entry.prev;
+        }
+        entry.armed = false;
+        this->armed_count_--;
+    }
+
+    bool armed(Slot slot) const { return this->entries_[static_cast<uint8_t>(slot)].armed; }
+    bool idle() const { return this->armed_count_ == 0; }
+
+    // Advances to now_ms and calls fire(Slot) for every slot that came due, earliest bucket first. fire may
+    // arm or cancel any slot, including the one that fired.
+    template<typename Fire> void poll(uint32_t now_ms, Fire &&fire) {
+        const uint32_t elapsed = (now_ms - this->last_poll_ms_) / TICK_MS;
+        if (elapsed == 0) {
+            return;
+        }
+        this->last_poll_ms_ += elapsed * TICK_MS;
+        const uint32_t from = this->tick_;
+        this->tick_ += elapsed;
+
+        // After a long stall every bucket is visited once rather than once per missed tick.
+        const uint32_t steps = std::min<uint32_t>(elapsed, BUCKETS);
+        for (uint32_t step = 1; step <= steps && this->armed_count_ > 0; step++) {
+            uint32_t due = 0;
+            for (uint8_t index = this->heads_[(from + step) % BUCKETS]; index != NONE;
+                 index = this->entries_[index].next) {
+                if (this->is_due_(index)) {
+                    due |= 1u << index;
+                }
+            }
+            // Collected first because fire() may relink the bucket being walked.
+            for (uint8_t index = 0; due != 0; index++, due >>= 1) {
+                if ((due & 1) && this->entries_[index].armed && this->is_due_(index)) {
+                    this->cancel(static_cast<Slot>(index));
+                    fire(static_cast<Slot>(index));
+                }
+            }
+        }
+    }
+
+protected:
+    static constexpr uint8_t NONE = 0xff;
+
+    struct Entry {
+        uint32_t deadline{0}; // in ticks
+        uint8_t  next{NONE};
+        uint8_t  prev{NONE};
+        bool     armed{false};
+    };
+
+    bool is_due_(uint8_t index) const {
+        return static_cast<int32_t>(this->entries_[index].deadline - this->tick_) <= 0;
+    }
+
+    std::array<Entry, SLOTS> entries_{};
+    std::array<uint8_t, BUCKETS> heads_{make_heads_()};
+    uint32_t tick_{0};
+    uint32_t last_poll_ms_{0};
+    uint8_t  armed_count_{0};
+
+    static constexpr std::array<uint8_t, BUCKETS> make_heads_() {
+        std::array<uint8_t, BUCKETS> heads{};
+        for (auto &head : heads) {
+            head = NONE;
+        }
+        return heads;
+    }
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace esphome {
+namespace secplus_gdo {
+
+enum class TriggerSource : uint8_t {
+    NONE = 0,
+    WALL_BUTTON,
+    COVER_COMMAND,
+    LIGHT_COMMAND,
+    LOCK_COMMAND,
+    WIRELESS_REMOTE,
+};
+
+inline const char *trigger_source_to_string(TriggerSource source) {
+    switch (source) {
+    case TriggerSource::WALL_BUTTON:
+        return "wall_button";
+    case TriggerSource::COVER_COMMAND:
+        return "cover";
+    case TriggerSource::LIGHT_COMMAND:
+        return "light";
+    case TriggerSource::LOCK_COMMAND:
+        return "lock";
+    case TriggerSource::WIRELESS_REMOTE:
+        return "wireless_remote";
+    case TriggerSource::NONE:
+    default:
+        return "none";
+    }
+}
+
+// Correlates a motor start with the most recent cause seen inside a bounded window.
+// Each cause keeps its own timestamp so interleaved events cannot clobber each other;
+// a motor start with no cause in the window is attributed to a wireless remote.
+class TriggerAttribution {
+public:
+    void set_window(uint32_t ms) { this->window_ms_ = ms; }
+    uint32_t get_window() const { return this->window_ms_; }
+
+    void record(TriggerSource source, uint32_t now) {
+        auto &cause = this->causes_[static_cast<uint8_t>(source)];
+        cause.timestamp = now;
+        cause.pending = true;
+    }
+
+    // Consumes every pending cause and returns the attributed source. latency_ms is set to the
+    // time between the cause and the motor start, or left untouched for a wireless remote.
+    TriggerSource attribute(uint32_t now, uint32_t *latency_ms) {
+        TriggerSource best = TriggerSource::WIRELESS_REMOTE;
+        uint32_t best_age = 0;
+        for (uint8_t i = 0; i < this->causes_.size(); i++) {
+            auto &cause = this->causes_[i];
+            if (!cause.pending) {
+                continue;
+            }
+            cause.pending = false;
+
+            const uint32_t age = now - cause.timestamp;
+            if (age > this->window_ms_) {
+                continue;
+            }
+            if (best == TriggerSource::WIRELESS_REMOTE || age < best_age) {
+                best = static_cast<TriggerSource>(i);
+                best_age = age;
+            }
+        }
+
+        if (best != TriggerSource::WIRELESS_REMOTE && latency_ms != nullptr) {
+            *latency_ms = best_age;
+        }
+        return best;
+    }
+
+protected:
+    struct Cause {
+        uint32_t timestamp{0};
+        bool     pending{false};
+    };
+
+    std::array<Cause, static_cast<uint8_t>(TriggerSource::WIRELESS_REMOTE)> causes_{};
+    uint32_t window_ms_{3000};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
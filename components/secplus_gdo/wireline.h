@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026  CircuitSetup
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_SECPLUS_GDO_ROLLING_CODE_SNIFF) || defined(USE_SECPLUS_GDO_MONITOR_ONLY)
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Security+ 2.0 wireline decoder compiled into gdolib from the secplus library. gdolib does not export the
+// header, so the prototype is repeated here.
+extern "C" int8_t decode_wireline(const uint8_t packet[19], uint32_t *rolling, uint64_t *fixed, uint32_t *data);
+
+namespace esphome {
+namespace secplus_gdo {
+
+// Security+ 2.0 wireline commands this component reads without gdolib.
+enum class WirelineCommand : uint16_t {
+    STATUS = 0x081,
+    DOOR_ACTION = 0x280,
+    MOTOR_ON = 0x284,
+    MOTION = 0x285,
+    OPENINGS = 0x48c,
+};
+
+struct WirelinePacket {
+    uint32_t rolling;
+    uint16_t command;
+    uint8_t  nibble;
+    uint8_t  byte1;
+    uint8_t  byte2;
+};
+
+// Reassembles wireline frames from raw UART bytes and decodes them. Used while gdolib is not reading the UART.
+class WirelineFramer {
+public:
+    static constexpr size_t FRAME_SIZE = 19;
+    // Rolling codes are 28 bits on the wire.
+    static constexpr uint32_t ROLLING_CODE_MASK = 0x0FFFFFFF;
+
+    // Returns true when byte completes a frame that decodes; the packet is written to out.
+    bool feed_byte(uint8_t byte, WirelinePacket *out) {
+        if (this->len_ < PREAMBLE.size()) {
+            if (byte == PREAMBLE[this->len_]) {
+                this->frame_[this->len_++] = byte;
+            } else {
+                // Restart the match; the byte may itself begin a preamble.
+                this->len_ = byte == PREAMBLE[0] ? 1 : 0;
+                this->frame_[0] = byte;
+            }
+            return false;
+        }
+
+        this->frame_[this->len_++] = byte;
+        if (this->len_ < FRAME_SIZE) {
+            return false;
+        }
+        this->len_ = 0;
+
+        uint32_t rolling = 0;
+        uint64_t fixed = 0;
+        uint32_t data = 0;
+        if (decode_wireline(this->frame_.data(), &rolling, &fixed, &data) != 0) {
+            this->rejected_++;
+            return false;
+        }
+
+        out->rolling = rolling & ROLLING_CODE_MASK;
+        out->command = static_cast<uint16_t>(((fixed >> 24) & 0xf00) | (data & 0xff));
+        out->nibble = (data >> 8) & 0x0f;
+        out->byte1 = (data >> 16) & 0xff;
+        out->byte2 = (data >> 24) & 0xff;
+        return true;
+    }
+
+    uint32_t rejected() const { return this->rejected_; }
+
+protected:
+    // Every frame starts with this preamble after the break.
+    static constexpr std::array<uint8_t, 3> PREAMBLE = {0x55, 0x01, 0x00};
+
+    std::array<uint8_t, FRAME_SIZE> frame_{};
+    size_t                          len_{0};
+    uint32_t                        rejected_{0};
+};
+
+} // namespace secplus_gdo
+} // namespace esphome
+
+#endif // USE_SECPLUS_GDO_ROLLING_CODE_SNIFF || USE_SECPLUS_GDO_MONITOR_ONLY
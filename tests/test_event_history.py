@@ -0,0 +1,257 @@
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+COMPONENT_DIR = Path("components/secplus_gdo").resolve()
+
+# Encodes records with encode_history_record, decodes them with HistoryDecoder and prints
+# "<kind> <value> <unix_ms>" per entry, then "end <offset>".
+CODEC_PROGRAM = r"""
+#include <cstdio>
+#include <vector>
+#include "event_history.h"
+
+using namespace esphome::secplus_gdo;
+
+struct VectorSource {
+    const std::vector<uint8_t> &bytes;
+    uint32_t pos{0};
+    bool next(uint8_t *byte) {
+        if (this->pos >= this->bytes.size()) {
+            return false;
+        }
+        *byte = this->bytes[this->pos++];
+        return true;
+    }
+    uint32_t offset() const { return this->pos; }
+};
+
+static void append(std::vector<uint8_t> &out, HistoryKind kind, uint32_t delta_ms, uint32_t value) {
+    uint8_t record[HISTORY_RECORD_MAX_SIZE];
+    const size_t len = encode_history_record(kind, delta_ms, value, record);
+    std::printf("len %zu\n", len);
+    out.insert(out.end(), record, record + len);
+}
+
+static void decode(const std::vector<uint8_t> &bytes) {
+    VectorSource source{bytes};
+    HistoryDecoder<VectorSource> decoder(source);
+    HistoryEntry entry;
+    while (decoder.next(&entry)) {
+        std::printf("%d %u %llu\n", static_cast<int>(entry.kind), static_cast<unsigned>(entry.value),
+                    static_cast<unsigned long long>(entry.unix_ms));
+    }
+    std::printf("end %u\n", static_cast<unsigned>(decoder.end()));
+}
+
+int main() {
+    // Varint boundaries, before any time base.
+    std::vector<uint8_t> varints;
+    for (uint32_t value : {0u, 127u, 128u, 16383u, 16384u, 2097151u, 2097152u, 268435455u, 268435456u, 4294967295u}) {
+        append(varints, HistoryKind::DOOR, value, value);
+    }
+    decode(varints);
+
+    // A time base anchors the deltas after it, and a later one re-anchors them.
+    std::vector<uint8_t> anchored;
+    append(anchored, HistoryKind::TIME_BASE, 0, 1700000000u);
+    append(anchored, HistoryKind::LIGHT, 500, 1);
+    append(anchored, HistoryKind::LOCK, 1500, 0);
+    append(anchored, HistoryKind::TIME_BASE, 0, 1700086400u);
+    append(anchored, HistoryKind::MOTION, 250, 1);
+    decode(anchored);
+
+    // A record torn mid-varint ends the data where it starts.
+    auto torn = anchored;
+    const size_t whole = torn.size();
+    append(torn, HistoryKind::OBSTRUCTION, 300, 200);
+    torn.pop_back();
+    std::printf("whole %zu\n", whole);
+    decode(torn);
+
+    // Erased flash ends the data too.
+    auto erased = anchored;
+    erased.insert(erased.end(), 8, HISTORY_END);
+    decode(erased);
+    return 0;
+}
+"""
+
+# Runs EventHistory on an in-memory partition whose writes can be made to fail.
+FLASH_PROGRAM = r"""
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "event_history.h"
+
+static std::vector<uint8_t> flash(3 * 4096, 0xff);
+static esp_partition_t partition{static_cast<uint32_t>(flash.size())};
+static int failing_writes = 0;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char *) {
+    return &partition;
+}
+esp_err_t esp_partition_read(const esp_partition_t *, size_t offset, void *dst, size_t size) {
+    std::memcpy(dst, flash.data() + offset, size);
+    return ESP_OK;
+}
+esp_err_t esp_partition_write(const esp_partition_t *, size_t offset, const void *src, size_t size) {
+    const auto *bytes = static_cast<const uint8_t *>(src);
+    // A failed write still programs part of the page, like an interrupted one on real flash.
+    const size_t programmed = failing_writes > 0 ? size / 2 : size;
+    for (size_t i = 0; i < programmed; i++) {
+        flash[offset + i] &= bytes[i];
+    }
+    if (failing_writes > 0) {
+        failing_writes--;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+esp_err_t esp_partition_erase_range(const esp_partition_t *, size_t offset, size_t size) {
+    std::memset(flash.data() + offset, 0xff, size);
+    return ESP_OK;
+}
+
+using namespace esphome::secplus_gdo;
+
+static void dump(EventHistory &history) {
+    history.for_each(HistoryQuery{}, [](const HistoryEntry &entry) {
+        std::printf("%d %u %llu\n", static_cast<int>(entry.kind), static_cast<unsigned>(entry.value),
+                    static_cast<unsigned long long>(entry.unix_ms));
+        return true;
+    });
+    std::printf("--\n");
+}
+
+// Walks one record per call, the way the hub spreads a dump across loop iterations.
+static void dump_in_steps(EventHistory &history) {
+    HistoryCursor cursor;
+    while (history.walk(HistoryQuery{}, cursor, 1, [](const HistoryEntry &entry) {
+        std::printf("%d %u %llu\n", static_cast<int>(entry.kind), static_cast<unsigned>(entry.value),
+                    static_cast<unsigned long long>(entry.unix_ms));
+        return true;
+    })) {
+    }
+    std::printf("--\n");
+}
+
+int main() {
+    EventHistory history;
+    history.begin("gdo_history", 0, 1700000000u);
+    history.record_change(HistoryKind::DOOR, 1, 1000, 1700000001u);
+    history.record_change(HistoryKind::LIGHT, 1, 2000, 1700000002u);
+    history.flush();
+
+    history.record_change(HistoryKind::LOCK, 1, 3000, 1700000003u);
+    failing_writes = 1;
+    history.flush();
+    history.record_change(HistoryKind::OBSTRUCTION, 1, 4500, 1700000004u);
+    history.flush();
+    dump(history);
+
+    EventHistory reopened;
+    reopened.begin("gdo_history", 0, 0);
+    dump(reopened);
+    dump_in_steps(reopened);
+    return 0;
+}
+"""
+
+STUBS = {
+    "esphome/core/defines.h": "#pragma once\n",
+    "esphome/core/log.h": (
+        "#pragma once\n"
+        "#define ESP_LOGD(...) ((void) 0)\n"
+        "#define ESP_LOGW(...) ((void) 0)\n"
+        "#define ESP_LOGE(...) ((void) 0)\n"
+    ),
+    "esp_err.h": (
+        "#pragma once\n"
+        "typedef int esp_err_t;\n"
+        "#define ESP_OK 0\n"
+        "#define ESP_FAIL -1\n"
+        "inline const char *esp_err_to_name(esp_err_t) { return \"\"; }\n"
+    ),
+    "esp_partition.h": (
+        "#pragma once\n"
+        "#include <cstddef>\n"
+        "#include <cstdint>\n"
+        '#include "esp_err.h"\n'
+        "typedef enum { ESP_PARTITION_TYPE_DATA } esp_partition_type_t;\n"
+        "typedef enum { ESP_PARTITION_SUBTYPE_ANY } esp_partition_subtype_t;\n"
+        "typedef struct { uint32_t size; } esp_partition_t;\n"
+        "const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t,\n"
+        "                                                const char *);\n"
+        "esp_err_t esp_partition_read(const esp_partition_t *, size_t, void *, size_t);\n"
+        "esp_err_t esp_partition_write(const esp_partition_t *, size_t, const void *, size_t);\n"
+        "esp_err_t esp_partition_erase_range(const esp_partition_t *, size_t, size_t);\n"
+    ),
+}
+
+
+def build_and_run(tmp_path, program, defines=(), sources=()):
+    for name, text in STUBS.items():
+        stub = tmp_path / "stubs" / name
+        stub.parent.mkdir(parents=True, exist_ok=True)
+        stub.write_text(text, encoding="utf-8")
+    source = tmp_path / "history_test.cpp"
+    binary = tmp_path / "history_test"
+    source.write_text(program, encoding="utf-8")
+    subprocess.run(
+        ["g++", "-std=c++17", "-Wall", "-Werror", *defines, f"-I{tmp_path / 'stubs'}", f"-I{COMPONENT_DIR}",
+         str(source), *sources, "-o", str(binary)],
+        check=True,
+    )
+    return subprocess.run([str(binary)], check=True, capture_output=True, text=True).stdout.split("\n")
+
+
+def entries(lines):
+    return [tuple(int(part) for part in line.split()) for line in lines if line and line[0].isdigit()]
+
+
+@pytest.mark.skipif(shutil.which("g++") is None, reason="needs a host C++ compiler")
+def test_history_records_round_trip_through_the_decoder(tmp_path):
+    lines = build_and_run(tmp_path, CODEC_PROGRAM)
+    lengths = [int(line.split()[1]) for line in lines if line.startswith("len ")]
+    whole = next(int(line.split()[1]) for line in lines if line.startswith("whole "))
+    decodes = []
+    block = []
+    for line in lines:
+        if line.startswith("end "):
+            decodes.append((entries(block), int(line.split()[1])))
+            block = []
+        elif line and line[0].isdigit():
+            block.append(line)
+    varints, anchored, torn, erased = decodes
+
+    values = [0, 127, 128, 16383, 16384, 2097151, 2097152, 268435455, 268435456, 4294967295]
+    assert lengths[:10] == [3, 3, 5, 5, 7, 7, 9, 9, 11, 11]
+    # Without a time base the deltas decode but the entries carry no date.
+    assert varints[0] == [(1, value, 0) for value in values]
+    assert varints[1] == sum(lengths[:10])
+
+    expected = [(2, 1, 1700000000500), (3, 0, 1700000002000), (5, 1, 1700086400250)]
+    assert anchored == (expected, whole)
+    assert torn == (expected, whole)
+    assert erased == (expected, whole)
+
+
+@pytest.mark.skipif(shutil.which("g++") is None, reason="needs a host C++ compiler")
+def test_history_moves_to_a_new_sector_after_a_failed_flush(tmp_path):
+    lines = build_and_run(
+        tmp_path,
+        FLASH_PROGRAM,
+        defines=["-DUSE_SECPLUS_GDO_HISTORY"],
+        sources=[str(COMPONENT_DIR / "event_history.cpp")],
+    )
+    live, reopened, stepped = "\n".join(lines).split("--")[:3]
+
+    # The lock change was in the failed page and is dropped; the obstruction after it keeps its time.
+    expected = [(1, 1, 1700000001000), (2, 1, 1700000002000), (4, 1, 1700000004500)]
+    assert entries(live.split("\n")) == expected
+    assert entries(reopened.split("\n")) == expected
+    assert entries(stepped.split("\n")) == expected
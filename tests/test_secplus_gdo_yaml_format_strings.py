@@ -7,6 +7,10 @@ CORE_PACKAGE = Path("packages/core-esp32-s3.yaml")
 SECPLUS_INIT = Path("components/secplus_gdo/__init__.py")
 SECPLUS_COMPONENT = Path("components/secplus_gdo/secplus_gdo.cpp")
 GDO_DOOR_COMPONENT = Path("components/secplus_gdo/cover/gdo_door.cpp")
+TEMP_PACKAGE = Path("packages/temp-sensor.yaml")
+DRY_CONTACT_CONFIG = Path("circuitsetup-gdo-dry-contact.yaml")
+DRY_CONTACT_DOOR_COMPONENT = Path("components/secplus_gdo/cover/gdo_dry_contact_door.cpp")
+SECPLUS_SWITCH_INIT = Path("components/secplus_gdo/switch/__init__.py")
 
 
 def test_secplus_config_owns_pinned_gdolib_release():
@@ -63,8 +67,11 @@ def test_gdolib_callback_defers_entity_updates_to_main_loop():
 
 
 def test_resync_client_id_uses_uint32_hex_format_macro():
-    source = SECPLUS_PACKAGE.read_text(encoding="utf-8")
+    package = SECPLUS_PACKAGE.read_text(encoding="utf-8")
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
 
+    assert "      - secplus_gdo.resync: cs_gdo" in package
+    assert "update_state(0)" not in package.split("name: Re-sync")[1].split("number:")[0]
     assert '0x%08" PRIX32 "' in source
     assert "0x%08X" not in source
 
@@ -84,3 +91,341 @@ def test_secplus_status_logs_use_sized_unsigned_format_macros():
     assert '"Paired devices: %" PRIu8 " remotes, %" PRIu8 " keypads, %" PRIu8 " wall controls, %" PRIu8' in source
     assert '"Open duration: %" PRIu16' in source
     assert '"Close duration: %" PRIu16' in source
+
+
+def test_wireless_remote_attribution_does_not_use_timer_pulse():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+
+    assert '"wireless_remote_off"' not in source
+    assert "this->attribution_.attribute(millis(), &latency_ms)" in source
+    assert "this->attribution_.record(TriggerSource::WALL_BUTTON, millis());" in source
+
+
+def test_blocking_gdolib_calls_in_event_handler_are_profiled():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+
+    assert "GDO_PROFILE_SCOPE(gdo->profiler(), profile_slot_for_event(event));" in source
+    assert "GDO_PROFILE_SCOPE(gdo->profiler(), ProfileSlot::GDO_SYNC);" in source
+    assert "GDO_PROFILE_SCOPE(gdo->profiler(), ProfileSlot::GDO_SET_ROLLING_CODE);" in source
+    assert "GDO_PROFILE_SCOPE(this->profiler_, ProfileSlot::DRIVER_RESTART);" in source
+
+
+def test_hot_path_state_logs_go_through_subsystem_logger():
+    component_source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+
+    assert 'GDO_LOGI(LogSubsystem::COMPONENT, "Openings: %" PRIu16, status->openings);' in component_source
+    assert 'GDO_LOGI(LogSubsystem::DOOR, "Door state: %s, position: %.0f%%"' in door_source
+    assert 'ESP_LOGI(TAG, "Door state:' not in door_source
+
+
+def test_unconsumed_gdolib_events_are_dropped_before_defer():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+
+    assert "if (!event_has_consumer(event)) {" in source
+    assert "case GDO_CB_EVENT_MOTION:\n            return SECPLUS_GDO_TRACKS_MOTION;" in source
+    assert 'cg.add_define(f"USE_SECPLUS_GDO_{platform.upper()}_{entity_type.upper()}")' in init_source
+
+
+def test_temp_package_pairs_samples_in_native_dew_point_component():
+    source = TEMP_PACKAGE.read_text(encoding="utf-8")
+
+    assert "lambda" not in source
+    assert "id(garage_temp_sensor).state" not in source
+    assert "  - platform: dew_point" in source
+    assert "    temperature_scale: ${temp_adjust}" in source
+    assert "    dew_point_offset: ${dew_point_offset}" in source
+
+
+def test_dry_contact_config_uses_native_cover_with_isr_timestamps():
+    config = DRY_CONTACT_CONFIG.read_text(encoding="utf-8")
+    source = DRY_CONTACT_DOOR_COMPONENT.read_text(encoding="utf-8")
+
+    assert "packages/garage-door-cover-dry-contact.yaml" in config
+    assert "packages/garage-door-cover-wired.yaml" not in config
+    assert "gpio::INTERRUPT_ANY_EDGE" in source
+    assert '"WARNING for %" PRIu32 "ms"' in source
+
+
+def test_obstruction_pin_feeds_the_same_path_as_status():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+
+    assert 'cg.add_define("USE_SECPLUS_GDO_OBSTRUCTION_PIN")' in init_source
+    assert "this->compare_obstruction_paths_(ObstructionPathCompare::PIN, obstructed, at_ms);" in source
+    assert "this->door_->cancel_pre_close_warning();" in source
+    assert '"Obstruction pin %s opener status by %" PRId32 " ms"' in source
+
+
+def test_gdo_events_wake_main_loop_and_priority_events_drain_first():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+
+    assert "App.wake_loop_threadsafe();" in source
+    assert "this->drain_priority_events_();\n#endif\n            process_gdo_event(&status, event, this);" in source
+    assert 'cg.add_define("USE_SECPLUS_GDO_PRIORITY_EVENTS")' in init_source
+
+
+def test_gdolib_uart_thresholds_and_task_priority_are_configurable():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+
+    assert "uart_set_rx_full_threshold(gdo_conf.uart_num, this->uart_rx_full_threshold_)" in source
+    assert "uart_set_rx_timeout(gdo_conf.uart_num, this->uart_rx_timeout_)" in source
+    assert "vTaskPrioritySet(nullptr, this->task_priority_);" in source
+    assert "cg.add(var.set_task_priority(config[CONF_TASK_PRIORITY]))" in init_source
+
+
+def test_rolling_code_sniff_listens_before_gdolib_starts():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+
+    assert "uart_read_bytes(GDO_UART_NUM, buf.data(), buf.size(), 0)" in source
+    assert "if (this->rolling_code_sniffing_) {\n            return;\n        }" in source
+    assert 'cg.add_define("USE_SECPLUS_GDO_ROLLING_CODE_SNIFF")' in init_source
+
+
+def test_monitor_only_never_starts_gdolib_and_drops_control_entities():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    init_source = SECPLUS_INIT.read_text(encoding="utf-8")
+    switch_source = SECPLUS_SWITCH_INIT.read_text(encoding="utf-8")
+
+    assert 'cg.add_define("USE_SECPLUS_GDO_MONITOR_ONLY")' in init_source
+    assert "uart_set_line_inverse(GDO_UART_NUM, UART_SIGNAL_RXD_INV)" in source
+    assert "if is_monitor_only(config[CONF_SECPLUS_GDO_ID]):\n" in switch_source
+
+
+def test_status_mirror_is_written_from_the_gdolib_callback():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+
+    assert "gdo->mirror_status(*status, event);\n        if (!event_has_consumer(event)) {" in source
+
+
+def test_travel_calibration_runs_through_the_cover_and_reports_to_the_hub():
+    package = SECPLUS_PACKAGE.read_text(encoding="utf-8")
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+
+    assert "      - secplus_gdo.calibrate_travel: gdo_door" in package
+    assert "this->parent_->apply_travel_calibration(" in door_source
+    assert "this->publish_calibration_progress_(NAN);" in door_source
+
+
+def test_light_and_lock_commands_go_through_the_reconciler():
+    light_source = Path("components/secplus_gdo/light/gdo_light.h").read_text(encoding="utf-8")
+    lock_source = Path("components/secplus_gdo/lock/gdo_lock.h").read_text(encoding="utf-8")
+
+    for source in (light_source, lock_source):
+        assert "this->command_.request(" in source
+        assert 'this->set_timeout("command", CommandReconciler::COALESCE_MS,' in source
+        assert "this->command_.confirm(" in source
+    assert "gdo_light_on()" not in light_source.split("void write_state")[1].split("void set_state")[0]
+    assert "gdo_lock()" not in lock_source.split("void control")[1].split("void set_sync_state")[0]
+
+
+def test_paired_devices_publish_only_changed_counts():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    paired = source.split("void GDOComponent::set_paired_devices(")[1]
+    paired = paired.split("void GDOComponent::load_paired_inventory_(")[0]
+
+    assert "if (changed == 0) {" in paired
+    assert "this->publish_paired_inventory_(changed);" in paired
+    assert "update_state(paired_devices." not in source
+    assert "refresh_paired_devices_" not in source
+    assert source.count("gdo_sync()") == 1
+
+
+def test_event_entities_fire_once_per_occurrence():
+    event_init = Path("components/secplus_gdo/event/__init__.py").read_text(encoding="utf-8")
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+
+    assert 'add_feature_define("event", config[CONF_TYPE])' in event_init
+    assert "event_types=EVENT_TYPES[config[CONF_TYPE]]" in event_init
+    assert 'this->button_event_->fire("press", this->event_time_us_);' in source
+    assert "if (state != this->obstruction_event_state_) {" in source
+
+
+def test_cover_triggers_run_from_door_state_updates():
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+    cover_init = Path("components/secplus_gdo/cover/__init__.py").read_text(encoding="utf-8")
+    set_state = door_source.split("void GDODoor::set_state(")[1].split("bool GDODoor::send_command_(")[0]
+
+    assert "this->process_triggers_(state, prev_position);" in set_state
+    assert '[(cg.bool_, "opened"), (cg.uint32, "duration_ms")]' in cover_init
+    assert ".extend(SECPLUS_TRIGGERS_SCHEMA)" in cover_init
+
+
+def test_auto_close_runs_through_the_cover_call_path():
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+    cover_init = Path("components/secplus_gdo/cover/__init__.py").read_text(encoding="utf-8")
+    auto_close = door_source.split("void GDODoor::auto_close_()")[1]
+
+    assert "this->make_call().set_command_close().perform();" in auto_close
+    assert 'cg.add_define("USE_SECPLUS_GDO_AUTO_CLOSE")' in cover_init
+    assert '"secplus_gdo.auto_close_hold"' in cover_init
+
+
+def test_door_health_is_fed_by_opener_measurements_and_persisted():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    features = Path("components/secplus_gdo/gdo_features.h").read_text(encoding="utf-8")
+    sensor_init = Path("components/secplus_gdo/sensor/__init__.py").read_text(encoding="utf-8")
+
+    assert "this->record_travel_(DoorHealth::OPENING, ms);" in source
+    assert "this->record_travel_(DoorHealth::CLOSING, ms);" in source
+    assert 'make_preference<DoorHealth>(fnv1_hash("secplus_gdo_door_health"))' in source
+    assert "#if defined(USE_SECPLUS_GDO_SENSOR_OPENINGS) || SECPLUS_GDO_TRACKS_DOOR_HEALTH" in features
+    assert '"obstruction_rate": 16,' in sensor_init
+
+
+def test_history_records_changes_before_entity_dispatch():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    history = Path("components/secplus_gdo/event_history.h").read_text(encoding="utf-8")
+    component_init = Path("components/secplus_gdo/__init__.py").read_text(encoding="utf-8")
+
+    assert "return event_has_entity_consumer(event) || event_has_history(event)" in source
+    assert "gdo->record_history(*status, event);" in source
+    assert "len += encode_varint(delta_ms, out + len);" in history
+    assert 'cg.add_define("USE_SECPLUS_GDO_HISTORY")' in component_init
+
+
+def test_history_dump_is_spread_across_loop_iterations():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    dump = source.split("void GDOComponent::dump_history(const HistoryQuery &query)")[1].split("\n    }\n")[0]
+    loop = source.split("void GDOComponent::loop()")[1].split("\n    }\n")[0]
+
+    assert "for_each" not in dump
+    assert "this->enable_loop();" in dump
+    assert "this->history_.walk(" in source
+    assert "HISTORY_DUMP_RECORDS_PER_LOOP" in source
+    assert "this->dump_history_batch_();" in loop
+
+
+def test_dump_history_action_requires_history_on_the_hub():
+    component_init = Path("components/secplus_gdo/__init__.py").read_text(encoding="utf-8")
+    action = component_init.split('"secplus_gdo.dump_history",')[1].split("async def")[0]
+
+    assert "record_dump_history_use," in action
+    assert "FINAL_VALIDATE_SCHEMA = final_validate_history" in component_init
+    assert 'CORE.data.get("secplus_gdo_dump_history", False) and CONF_HISTORY not in config' in component_init
+
+
+def test_status_snapshot_publishes_only_changes_with_a_generation():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    snapshot = source.split("void GDOComponent::publish_status_snapshot_()")[1].split("#endif")[0]
+
+    assert "snapshot == this->status_snapshot_" in snapshot
+    assert "this->status_snapshot_generation_++;" in snapshot
+    assert "gdo->schedule_status_snapshot();" in source
+
+
+def test_warning_sequencer_plays_build_time_tone_tables_and_stops_with_the_warning():
+    import importlib.util
+
+    spec = importlib.util.spec_from_file_location("rtttl", "components/secplus_gdo/cover/rtttl.py")
+    rtttl = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(rtttl)
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+    end_warning = door_source.split("void GDODoor::end_pre_close_warning_()")[1].split("\n}\n")[0]
+
+    assert rtttl.parse_rtttl("t:d=4,o=6,b=160:16e,8p,4a5.") == [(1319, 94), (0, 188), (880, 563)]
+    assert end_warning.index("this->warning_sequencer_.stop();") < end_warning.index("->trigger();")
+    assert "this->end_pre_close_warning_();" in door_source.split("void GDODoor::cancel_pre_close_warning()")[1]
+
+
+def test_warning_sequencer_pins_are_validated_and_its_ledc_channels_reserved():
+    cover_init = Path("components/secplus_gdo/cover/__init__.py").read_text(encoding="utf-8")
+    schema = cover_init.split("WARNING_SEQUENCER_SCHEMA = cv.Schema(")[1].split("CONFIG_SCHEMA")[0]
+    final_validate = cover_init.split("def final_validate_warning_sequencer(config):")[1]
+    final_validate = final_validate.split("FINAL_VALIDATE_SCHEMA")[0]
+
+    assert "internal_gpio_output_pin_number" not in schema
+    assert schema.count("pins.internal_gpio_output_pin_schema") == 2
+    assert "await cg.gpio_pin_expression(warning[CONF_LED_PIN])" in cover_init
+    assert "await cg.gpio_pin_expression(warning[CONF_BUZZER_PIN])" in cover_init
+    assert "FINAL_VALIDATE_SCHEMA = final_validate_warning_sequencer" in cover_init
+    assert 'output.get(CONF_PLATFORM) == "ledc"' in final_validate
+    assert "channel = output.get(CONF_CHANNEL, index)" in final_validate
+    assert "if channel in reserved:" in final_validate
+
+
+def test_obstruction_aborts_queued_door_work_and_times_the_reversal():
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    report = door_source.split("void GDODoor::report_obstruction(")[1].split("void GDODoor::track_reversal_(")[0]
+    publish = source.split("void GDOComponent::publish_obstruction_(")[1].split("#ifdef USE_SECPLUS_GDO_OBSTRUCTION_PIN")[0]
+
+    assert "this->cancel_pre_close_warning();" in report
+    assert "this->timers_.cancel(DoorTimer::RECLOSE);" in report
+    assert "this->current_operation = COVER_OPERATION_OPENING;" in report
+    assert "this->door_->report_obstruction(obstructed, at_us);" in publish
+    assert "cancel_pre_close_warning" not in publish
+    assert "this->parent_->publish_reversal_time(this->last_reversal_ms_);" in door_source
+
+
+def test_deferred_log_drops_records_without_a_consumer_and_formats_them_once():
+    source = Path("components/secplus_gdo/gdo_log.cpp").read_text(encoding="utf-8")
+    header = Path("components/secplus_gdo/gdo_log.h").read_text(encoding="utf-8")
+    is_logged = source.split("bool GDOLog::is_logged_(")[1].split("size_t GDOLog::drain(")[0]
+    drain = source.split("size_t GDOLog::drain(")[1]
+
+    assert is_logged.index("logger::global_logger->level_for(tag)") < is_logged.index("get_baud_rate() > 0")
+    assert "client->get_log_subscription_level()" in is_logged
+    assert drain.index("if (!this->is_logged_(record)) {") < drain.index("record.emit(record,")
+    assert "snprintf" not in header and "char line[" not in source
+    assert "esp_log_printf_(record.level, tag, __LINE__, record.format, record.timestamp, values...);" in header
+
+
+def test_dry_contact_close_while_moving_waits_a_toggle_gap_after_the_stop_press():
+    source = DRY_CONTACT_DOOR_COMPONENT.read_text(encoding="utf-8")
+    close_tail = source.split('ESP_LOGD(TAG, "Closing to %.0f%% after warning", pos * 100.0f);')[1]
+    while_moving = close_tail.split("if (this->is_moving_()) {")[1].split("\n        }\n")[0]
+
+    assert while_moving.index("this->press_();") < while_moving.index("TOGGLE_GAP_MS")
+    assert "this->timers_.arm(DryContactTimer::CLOSE_AFTER_STOP, millis(), TOGGLE_GAP_MS);" in while_moving
+    assert while_moving.rstrip().endswith("return;")
+
+
+def test_reversal_display_is_bounded_by_a_timeout_and_the_door_position():
+    door_source = GDO_DOOR_COMPONENT.read_text(encoding="utf-8")
+    report = door_source.split("void GDODoor::report_obstruction(")[1].split("void GDODoor::track_reversal_(")[0]
+    closing = door_source.split("case GDO_DOOR_STATE_CLOSING:")[1].split("break;")[0]
+
+    assert "this->start_timer_(DoorTimer::REVERSAL_TIMEOUT, REVERSAL_TIMEOUT_MS);" in report
+    assert "position < this->reversal_obstructed_position_" in closing
+    assert "case DoorTimer::REVERSAL_TIMEOUT:" in door_source
+
+
+def test_auto_close_time_is_published_as_an_iso_8601_deadline():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    publish = source.split("void GDOComponent::publish_auto_close_time(")[1].split("#endif")[0]
+    text_sensor_init = Path("components/secplus_gdo/text_sensor/__init__.py").read_text(encoding="utf-8")
+    sensor_init = Path("components/secplus_gdo/sensor/__init__.py").read_text(encoding="utf-8")
+
+    assert '"auto_close_time": 3,' in text_sensor_init
+    assert "auto_close_time" not in sensor_init
+    assert "now.tv_usec / 1000 + remaining_ms" in publish
+    assert '"%Y-%m-%dT%H:%M:%S"' in publish
+    assert '".%03u+00:00"' in publish
+    assert "now.tv_sec < CLOCK_SET_MIN_TIME" in publish
+
+
+def test_reset_door_timings_button_builds_with_monitor_only():
+    package = SECPLUS_PACKAGE.read_text(encoding="utf-8")
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    reset_button = package.split("name: Reset door timings")[1].split("- platform:")[0]
+    reset = source.split("void GDOComponent::reset_door_timings() {")[1].split("void GDOComponent::resync() {")[0]
+
+    assert "id(gdo_open_duration)" not in package and "id(gdo_close_duration)" not in package
+    assert "secplus_gdo.reset_door_timings: cs_gdo" in reset_button
+    assert reset.index("#ifdef USE_SECPLUS_GDO_MONITOR_ONLY") < reset.index("this->open_duration_->update_state(0);")
+
+
+def test_door_health_days_follow_the_saved_wall_clock_and_saves_are_batched():
+    source = SECPLUS_COMPONENT.read_text(encoding="utf-8")
+    health = Path("components/secplus_gdo/door_health.h").read_text(encoding="utf-8")
+
+    assert "uint32_t                   day_start{0};" in health
+    assert "bool roll_days(uint32_t now) {" in health
+    assert '"door_health_day"' not in source
+    assert source.count("this->door_health_pref_.save(&this->door_health_);") == 1
+    assert 'this->set_interval("door_health", DOOR_HEALTH_SAVE_INTERVAL_MS' in source
@@ -0,0 +1,83 @@
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+
+COMPONENT_DIR = Path("components/secplus_gdo").resolve()
+
+# Drives the wheel with a virtual clock and prints "<ms> <slot>" for every slot that fires.
+VIRTUAL_TIME_PROGRAM = r"""
+#include <cstdio>
+#include "timer_wheel.h"
+
+using namespace esphome::secplus_gdo;
+
+enum class Slot : uint8_t { A, B, C, D, COUNT };
+
+int main() {
+    TimerWheel<Slot, 8, 10> wheel;
+    uint32_t now = 4294967000u;  // a few hundred ms before millis() wraps
+    auto fire = [&](Slot slot) {
+        std::printf("%u %d\n", static_cast<unsigned>(now - 4294967000u), static_cast<int>(slot));
+        if (slot == Slot::C) {
+            wheel.arm(Slot::C, now, 1000);  // re-arms itself once from its own callback
+            wheel.cancel(Slot::D);          // and cancels a slot due in the same bucket
+        }
+    };
+
+    wheel.arm(Slot::A, now, 25);
+    wheel.arm(Slot::B, now, 5000);   // longer than one turn of the wheel
+    wheel.arm(Slot::C, now, 300);
+    wheel.arm(Slot::D, now, 300);
+    wheel.arm(Slot::A, now, 50);     // re-arming moves the deadline
+    for (int i = 0; i < 700 && !wheel.idle(); i++) {
+        now += i == 200 ? 2000 : 7;  // one long stall
+        wheel.poll(now, fire);
+        if (i == 150) {
+            wheel.cancel(Slot::C);
+        }
+    }
+    std::printf("idle %d\n", wheel.idle() ? 1 : 0);
+    return 0;
+}
+"""
+
+
+@pytest.mark.skipif(shutil.which("g++") is None, reason="needs a host C++ compiler")
+def test_timer_wheel_fires_in_virtual_time(tmp_path):
+    source = tmp_path / "timer_wheel_test.cpp"
+    binary = tmp_path / "timer_wheel_test"
+    source.write_text(VIRTUAL_TIME_PROGRAM, encoding="utf-8")
+    subprocess.run(
+        ["g++", "-std=c++17", "-Wall", "-Werror", f"-I{COMPONENT_DIR}", str(source), "-o", str(binary)],
+        check=True,
+    )
+    lines = subprocess.run([str(binary)], check=True, capture_output=True, text=True).stdout.split("\n")
+
+    fired = [tuple(int(part) for part in line.split()) for line in lines if line and not line.startswith("idle")]
+    assert [slot for _, slot in fired] == [0, 2, 1]
+    a, c, b = (ms for ms, _ in fired)
+    assert 50 <= a < 50 + 10 + 7
+    assert 300 <= c < 300 + 10 + 7
+    # The re-armed C was cancelled before coming due; B fires on the first poll after the stall.
+    assert 5000 <= b < 5000 + 2000 + 10
+    assert "idle 1" in lines
+
+
+def test_cover_and_hub_one_shot_timers_use_the_wheel():
+    door = (COMPONENT_DIR / "cover/gdo_door.cpp").read_text(encoding="utf-8")
+    dry_contact = (COMPONENT_DIR / "cover/gdo_dry_contact_door.cpp").read_text(encoding="utf-8")
+    hub = (COMPONENT_DIR / "secplus_gdo.cpp").read_text(encoding="utf-8")
+    hub_header = (COMPONENT_DIR / "secplus_gdo.h").read_text(encoding="utf-8")
+
+    for name in ("pre_close", "stop_door", "open_door", "close_door", "auto_close", "calibration"):
+        assert f'"{name}"' not in door
+    assert "set_timeout(" not in dry_contact and "cancel_timeout(" not in dry_contact
+    for name in ("startup_secplus_status_log", "diagnostic_driver_restart", "paired_refresh", "monitor_motion_clear"):
+        assert f'"{name}"' not in hub
+    assert '"status_snapshot"' not in hub_header
+    assert "this->timers_.poll(millis(), [this](DoorTimer timer) { this->on_timer_(timer); });" in door
+    assert "this->timers_.poll(millis(), [this](HubTimer timer) { this->on_timer_(timer); });" in hub
+    assert "this->timers_.poll(millis(), [this](DryContactTimer timer) { this->on_timer_(timer); });" in dry_contact